@@ -0,0 +1,204 @@
+#!/usr/bin/env python3
+#
+# Copyright © 2016 Intel Corporation
+#
+# Permission is hereby granted, free of charge, to any person obtaining a
+# copy of this software and associated documentation files (the "Software"),
+# to deal in the Software without restriction, including without limitation
+# the rights to use, copy, modify, merge, publish, distribute, sublicense,
+# and/or sell copies of the Software, and to permit persons to whom the
+# Software is furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice (including the next
+# paragraph) shall be included in all copies or substantial portions of the
+# Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+# THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+# IN THE SOFTWARE.
+
+
+"""Benchmarks query2-info, running a fixed set of scenarios.
+
+Usage: bench.py [options]
+
+Each scenario is run a few times to warm up the caches, and then
+measured over several repetitions, reporting the median. The sweep
+scenarios use --time-sweep for the time spent on the queries, so the
+queries/sec and ns/cell don't include the startup, and the cold start
+one measures the time from exec until the first result is written. The
+mock scenarios run on libq2i-mock.so with no latency, so they measure
+the overhead of the tool itself: formatting, allocation, enum lookups. Their
+database, --mock-database, is written with query2-info -b --database,
+so the 32-bit queries get the results of the driver.
+
+The results are written as JSON, and compared with a previous run given
+with --baseline: the scenarios slower than it by more than --threshold
+percent are reported, and the exit status is 1.
+"""
+
+import argparse
+import json
+import os
+import re
+import statistics
+import subprocess
+import sys
+import time
+
+# name, whether it runs on the mock driver, metric, arguments
+SCENARIOS = [
+    ('cold-start', False, 'first_result_ms', []),
+    ('sweep', False, 'ns_per_cell', []),
+    ('sweep-b', False, 'ns_per_cell', ['-b']),
+    ('sweep-f', False, 'ns_per_cell', ['-f']),
+    ('sweep-f-b', False, 'ns_per_cell', ['-f', '-b']),
+    ('single-pname', False, 'ns_per_cell',
+     ['--pnames', 'GL_INTERNALFORMAT_SUPPORTED']),
+    ('mock-cold-start', True, 'first_result_ms', []),
+    ('mock-output-csv', True, 'ns_per_cell', []),
+    ('mock-output-csv-b', True, 'ns_per_cell', ['-b']),
+    ('mock-output-bin', True, 'ns_per_cell', ['--format', 'bin']),
+]
+
+SWEEP_TIME = re.compile(r'^Sweep time: ([0-9.]+) ms for ([0-9]+) queries$',
+                        re.MULTILINE)
+
+
+def run_once(command, env, first_result):
+    """Runs @command, returning its measurements."""
+    start = time.monotonic()
+    process = subprocess.Popen(command, env=env,
+                               stdout=subprocess.PIPE if first_result
+                               else subprocess.DEVNULL,
+                               stderr=subprocess.PIPE)
+    sample = {}
+    if first_result:
+        process.stdout.readline()
+        sample['first_result_ms'] = (time.monotonic() - start) * 1e3
+        while process.stdout.read(65536):
+            pass
+    stderr = process.stderr.read().decode(errors='replace')
+    _, status, usage = os.wait4(process.pid, 0)
+    sample['wall_ms'] = (time.monotonic() - start) * 1e3
+    process.returncode = os.waitstatus_to_exitcode(status)
+    if process.returncode != 0:
+        sys.exit('`{}\' failed with {}:\n{}'.format(
+            ' '.join(command), process.returncode, stderr))
+
+    # ru_maxrss is in KiB on Linux
+    sample['peak_rss_kib'] = usage.ru_maxrss
+    match = SWEEP_TIME.search(stderr)
+    if match:
+        sweep_ms = float(match.group(1))
+        queries = int(match.group(2))
+        sample['sweep_ms'] = sweep_ms
+        sample['queries'] = queries
+        if queries > 0 and sweep_ms > 0:
+            sample['queries_per_sec'] = queries / (sweep_ms / 1e3)
+            sample['ns_per_cell'] = sweep_ms * 1e6 / queries
+    return sample
+
+
+def run_scenario(args, mock, metric, scenario_args):
+    command = [args.binary, '--time-sweep'] + scenario_args
+    env = dict(os.environ)
+    if mock:
+        command += ['--backend', 'surfaceless']
+        env['LD_PRELOAD'] = args.mock_library
+        env['Q2I_MOCK_DATABASE'] = args.mock_database
+        env['Q2I_MOCK_LATENCY_NS'] = '0'
+    first_result = metric == 'first_result_ms'
+
+    for _ in range(args.warmup):
+        run_once(command, env, first_result)
+    samples = [run_once(command, env, first_result)
+               for _ in range(args.repetitions)]
+
+    result = {'command': ' '.join(command), 'metric': metric,
+              'repetitions': len(samples)}
+    for key in samples[0]:
+        values = [sample[key] for sample in samples if key in sample]
+        if key == 'peak_rss_kib':
+            result[key] = max(values)
+        elif key == 'queries':
+            result[key] = values[0]
+        else:
+            result[key] = statistics.median(values)
+    return result
+
+
+def compare(results, baseline, threshold):
+    """Returns the descriptions of the regressions of @results."""
+    regressions = []
+    for name, result in sorted(results.items()):
+        reference = baseline.get('scenarios', {}).get(name)
+        metric = result['metric']
+        if reference is None or metric not in reference or \
+           metric not in result:
+            continue
+        change = (result[metric] / reference[metric] - 1) * 100
+        print('{:20} {:>15} {:12.3f} -> {:12.3f} ({:+.1f}%)'.format(
+            name, metric, reference[metric], result[metric], change))
+        if change > threshold:
+            regressions.append('{}: {} {:+.1f}%'.format(name, metric, change))
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__.strip().split('\n')[0])
+    parser.add_argument('--binary', default='./query2-info')
+    parser.add_argument('--mock-library', default='./libq2i-mock.so')
+    parser.add_argument('--mock-database', default='bench-mock.db')
+    parser.add_argument('--mock-only', action='store_true',
+                        help='only the scenarios not needing a GPU')
+    parser.add_argument('--scenarios', default='',
+                        help='comma separated names, all by default')
+    parser.add_argument('--warmup', type=int, default=2)
+    parser.add_argument('--repetitions', type=int, default=5)
+    parser.add_argument('--output', default='bench.json')
+    parser.add_argument('--baseline')
+    parser.add_argument('--threshold', type=float, default=10.0,
+                        help='percent slower than the baseline that is '
+                        'a regression')
+    args = parser.parse_args()
+    if args.repetitions < 1:
+        sys.exit('--repetitions must be at least 1')
+
+    selected = [name for name in args.scenarios.split(',') if name]
+    unknown = set(selected) - set(s[0] for s in SCENARIOS)
+    if unknown:
+        sys.exit('Unknown scenarios: {}'.format(', '.join(sorted(unknown))))
+
+    results = {}
+    for name, mock, metric, scenario_args in SCENARIOS:
+        if (selected and name not in selected) or \
+           (args.mock_only and not mock):
+            continue
+        result = run_scenario(args, mock, metric, scenario_args)
+        results[name] = result
+        print('{:20} {:>15} {:12.3f}  peak RSS {} KiB'.format(
+            name, metric, result.get(metric, float('nan')),
+            result['peak_rss_kib']))
+
+    with open(args.output, 'w') as out:
+        json.dump({'warmup': args.warmup, 'repetitions': args.repetitions,
+                   'scenarios': results}, out, indent=2, sort_keys=True)
+        out.write('\n')
+
+    if args.baseline:
+        with open(args.baseline) as f:
+            baseline = json.load(f)
+        regressions = compare(results, baseline, args.threshold)
+        if regressions:
+            sys.exit('Regressions over {}%:\n  {}'.format(
+                args.threshold, '\n  '.join(regressions)))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,347 @@
+/*
+ * Copyright © 2016 Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+/**
+ * On-disk cache of the results of a sweep.
+ *
+ * The file starts with a header with the options of the run and the
+ * fingerprints of the driver (see fingerprint.c), followed by one
+ * record per result, in the order of the sweep. All the values are
+ * stored with the native endianness, as the cache is not intended to
+ * be moved to other machines.
+ *
+ * A cache is only loaded if the options are the same, and the system
+ * and libraries fingerprints still match, so it can be used without
+ * creating a context.
+ */
+#define _GNU_SOURCE
+#include "cache.h"
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "file-io.h"
+#include "fingerprint.h"
+#include "output.h"
+
+#define CACHE_MAGIC "Q2ICACHE"
+#define CACHE_VERSION 1
+
+enum cache_string {
+   CACHE_STRING_OPTIONS,
+   CACHE_STRING_SYSTEM,
+   CACHE_STRING_LIBRARIES,
+   CACHE_STRING_GL,
+   CACHE_STRING_COUNT,
+};
+
+/* Header of each result. The values follow it. */
+typedef struct _cache_record {
+   uint32_t pname;
+   uint32_t target;
+   uint32_t internalformat;
+   uint8_t testing64;
+   uint8_t padding;
+   uint16_t num_values;
+} cache_record;
+
+struct _result_cache {
+   char *data;
+   size_t size;
+   size_t offset;
+   char *strings[CACHE_STRING_COUNT];
+   /* Descriptor of the pname of the last result read, as the results
+    * of a pname are consecutive */
+   const pname_descriptor *descriptor;
+};
+
+struct _result_cache_writer {
+   char *path;
+   atomic_file *file;
+   output_buffer *out;
+};
+
+static bool
+read_file(const char *path,
+          char **data,
+          size_t *size)
+{
+   struct stat st;
+   size_t done = 0;
+   int fd;
+
+   fd = open(path, O_RDONLY | O_CLOEXEC);
+   if (fd < 0)
+      return false;
+
+   if (fstat(fd, &st) < 0) {
+      close(fd);
+      return false;
+   }
+
+   *size = st.st_size;
+   *data = (char*) malloc(*size + 1);
+   while (done < *size) {
+      ssize_t result = read(fd, *data + done, *size - done);
+      if (result <= 0) {
+         free(*data);
+         close(fd);
+         return false;
+      }
+      done += result;
+   }
+   close(fd);
+
+   return true;
+}
+
+static bool
+read_bytes(result_cache *cache,
+           void *dst,
+           size_t size)
+{
+   if (cache->offset + size > cache->size)
+      return false;
+
+   memcpy(dst, cache->data + cache->offset, size);
+   cache->offset += size;
+
+   return true;
+}
+
+static bool
+read_string(result_cache *cache,
+            char **str)
+{
+   uint32_t len;
+
+   if (!read_bytes(cache, &len, sizeof(len)) ||
+       cache->offset + len > cache->size)
+      return false;
+
+   *str = strndup(cache->data + cache->offset, len);
+   cache->offset += len;
+
+   return true;
+}
+
+/*
+ * Loads the cache at @path. Returns NULL if it doesn't exist, it was
+ * stored with different @options, or the driver changed since then.
+ * When a context exists, @gl_fingerprint is its fingerprint_gl(), to
+ * also reject a cache answered by another driver loaded from the same
+ * libraries; it is NULL otherwise.
+ */
+result_cache*
+result_cache_load(const char *path,
+                  const char *options,
+                  const char *gl_fingerprint)
+{
+   result_cache *cache;
+   char magic[sizeof(CACHE_MAGIC) - 1];
+   uint32_t version;
+   char *system;
+   bool valid;
+   unsigned i;
+
+   cache = (result_cache*) calloc(1, sizeof(result_cache));
+   if (!read_file(path, &cache->data, &cache->size)) {
+      free(cache);
+      return NULL;
+   }
+
+   valid = read_bytes(cache, magic, sizeof(magic)) &&
+      memcmp(magic, CACHE_MAGIC, sizeof(magic)) == 0 &&
+      read_bytes(cache, &version, sizeof(version)) &&
+      version == CACHE_VERSION;
+
+   for (i = 0; valid && i < CACHE_STRING_COUNT; i++)
+      valid = read_string(cache, &cache->strings[i]);
+
+   if (valid) {
+      system = fingerprint_system();
+      valid = strcmp(cache->strings[CACHE_STRING_OPTIONS], options) == 0 &&
+         strcmp(cache->strings[CACHE_STRING_SYSTEM], system) == 0 &&
+         fingerprint_libraries_match(cache->strings[CACHE_STRING_LIBRARIES]) &&
+         (gl_fingerprint == NULL ||
+          strcmp(cache->strings[CACHE_STRING_GL], gl_fingerprint) == 0);
+      free(system);
+   }
+
+   if (!valid)
+      result_cache_clear(&cache);
+
+   return cache;
+}
+
+/*
+ * Returns the GL fingerprint of the driver that answered the cached
+ * queries.
+ */
+const char*
+result_cache_get_gl_fingerprint(const result_cache *cache)
+{
+   return cache->strings[CACHE_STRING_GL];
+}
+
+/*
+ * Reads the next result of @cache into @result. Returns false if there
+ * are no more results.
+ */
+bool
+result_cache_next(result_cache *cache,
+                  query_result *result)
+{
+   cache_record record;
+
+   if (!read_bytes(cache, &record, sizeof(record)) ||
+       record.num_values > QUERY_RESULT_MAX_VALUES ||
+       !read_bytes(cache, result->values,
+                   record.num_values * sizeof(GLint64)))
+      return false;
+
+   if (cache->descriptor == NULL || cache->descriptor->pname != record.pname)
+      cache->descriptor = pname_descriptor_get(record.pname);
+
+   result->descriptor = cache->descriptor;
+   result->pname = record.pname;
+   result->target = record.target;
+   result->internalformat = record.internalformat;
+   result->testing64 = record.testing64;
+   result->num_values = record.num_values;
+
+   return true;
+}
+
+/*
+ * Frees @cache, and sets its value to NULL.
+ */
+void
+result_cache_clear(result_cache **cache)
+{
+   result_cache *_cache = *cache;
+   unsigned i;
+
+   if (_cache == NULL)
+      return;
+
+   for (i = 0; i < CACHE_STRING_COUNT; i++)
+      free(_cache->strings[i]);
+   free(_cache->data);
+   free(_cache);
+   *cache = NULL;
+}
+
+static void
+write_string(output_buffer *out,
+             const char *str)
+{
+   uint32_t len = strlen(str);
+
+   output_buffer_append(out, (const char*) &len, sizeof(len));
+   output_buffer_append(out, str, len);
+}
+
+/*
+ * Starts writing a new cache for @path. It needs a current context, to
+ * get the fingerprint of the driver. The cache is written to a
+ * temporary file, and only replaces @path on
+ * result_cache_writer_finish, so a partial run never leaves a partial
+ * cache.
+ */
+result_cache_writer*
+result_cache_writer_new(const char *path,
+                        const char *options)
+{
+   result_cache_writer *writer;
+   uint32_t version = CACHE_VERSION;
+   char *strings[CACHE_STRING_COUNT];
+   unsigned i;
+
+   writer = (result_cache_writer*) calloc(1, sizeof(result_cache_writer));
+   writer->file = atomic_file_new(path);
+   if (writer->file == NULL) {
+      fprintf(stderr, "Error creating cache file `%s'.\n", path);
+      free(writer);
+      return NULL;
+   }
+   writer->path = strdup(path);
+   writer->out = atomic_file_get_output(writer->file);
+
+   strings[CACHE_STRING_OPTIONS] = strdup(options);
+   strings[CACHE_STRING_SYSTEM] = fingerprint_system();
+   strings[CACHE_STRING_LIBRARIES] = fingerprint_libraries();
+   strings[CACHE_STRING_GL] = fingerprint_gl();
+
+   output_buffer_append(writer->out, CACHE_MAGIC, sizeof(CACHE_MAGIC) - 1);
+   output_buffer_append(writer->out, (const char*) &version, sizeof(version));
+   for (i = 0; i < CACHE_STRING_COUNT; i++) {
+      write_string(writer->out, strings[i] ? strings[i] : "");
+      free(strings[i]);
+   }
+
+   return writer;
+}
+
+void
+result_cache_writer_add(result_cache_writer *writer,
+                        const query_result *result)
+{
+   cache_record record;
+
+   memset(&record, 0, sizeof(record));
+   record.pname = result->pname;
+   record.target = result->target;
+   record.internalformat = result->internalformat;
+   record.testing64 = result->testing64;
+   record.num_values = result->num_values;
+
+   output_buffer_append(writer->out, (const char*) &record, sizeof(record));
+   output_buffer_append(writer->out, (const char*) result->values,
+                        result->num_values * sizeof(GLint64));
+}
+
+/*
+ * Writes the pending data of @writer, replaces the previous cache with
+ * it, and frees @writer. Returns false if there was any error.
+ */
+bool
+result_cache_writer_finish(result_cache_writer **writer)
+{
+   result_cache_writer *_writer = *writer;
+   bool success;
+
+   success = atomic_file_finish(&_writer->file);
+   if (!success)
+      fprintf(stderr, "Error writing cache file `%s'.\n", _writer->path);
+
+   free(_writer->path);
+   free(_writer);
+   *writer = NULL;
+
+   return success;
+}
@@ -0,0 +1,56 @@
+/*
+ * Copyright © 2016 Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+#ifndef CACHE_H
+#define CACHE_H
+
+#include <stdbool.h>
+
+#include "util.h"
+
+/* Results of a previous run stored on disk, together with the
+ * fingerprint of the driver that answered them, and the options used
+ * for that run. */
+typedef struct _result_cache result_cache;
+
+result_cache* result_cache_load(const char *path,
+                                const char *options,
+                                const char *gl_fingerprint);
+
+const char* result_cache_get_gl_fingerprint(const result_cache *cache);
+
+bool result_cache_next(result_cache *cache,
+                       query_result *result);
+
+void result_cache_clear(result_cache **cache);
+
+typedef struct _result_cache_writer result_cache_writer;
+
+result_cache_writer* result_cache_writer_new(const char *path,
+                                             const char *options);
+
+void result_cache_writer_add(result_cache_writer *writer,
+                             const query_result *result);
+
+bool result_cache_writer_finish(result_cache_writer **writer);
+
+#endif /* CACHE_H */
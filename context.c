@@ -0,0 +1,592 @@
+/*
+ * Copyright © 2016 Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+/**
+ * Creation of the GL context used to run the queries.
+ *
+ * The EGL backends (surfaceless and GBM) and OSMesa only create a
+ * context, and are the ones tried first by the auto backend. GLUT is
+ * kept as the last option, as it needs a display server and creates a
+ * window that is never used. The auto backend only tries it when
+ * DISPLAY is set, as freeglut exits when it can't open the display.
+ */
+#include "context.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <glob.h>
+#include <unistd.h>
+
+#include <GL/glew.h>
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+
+#ifdef HAVE_GBM
+#include <gbm.h>
+#endif
+
+#ifdef HAVE_OSMESA
+#include <GL/osmesa.h>
+#endif
+
+#include "glut_wrap.h"
+
+#define WINDOW_WIDTH    640
+#define WINDOW_HEIGHT   480
+
+#define GBM_RENDER_NODES "/dev/dri/renderD*"
+
+struct _context {
+   enum context_backend backend;
+   unsigned flags;
+
+   EGLDisplay egl_display;
+   EGLContext egl_context;
+   /* Sibling contexts share the display of the context they were
+    * created from, so they should not terminate it */
+   bool owns_display;
+
+#ifdef HAVE_GBM
+   int gbm_fd;
+   struct gbm_device *gbm;
+#endif
+
+#ifdef HAVE_OSMESA
+   OSMesaContext osmesa_context;
+   /* OSMesa can't make a context current without a buffer, so we use
+    * the smallest one possible */
+   GLubyte osmesa_buffer[4];
+#endif
+
+   int glut_window;
+};
+
+static const struct {
+   const char *name;
+   enum context_backend backend;
+} backend_names[] = {
+   { "auto", CONTEXT_BACKEND_AUTO },
+   { "surfaceless", CONTEXT_BACKEND_SURFACELESS },
+   { "gbm", CONTEXT_BACKEND_GBM },
+   { "osmesa", CONTEXT_BACKEND_OSMESA },
+   { "glut", CONTEXT_BACKEND_GLUT },
+};
+
+bool
+context_backend_from_name(const char *name,
+                          enum context_backend *backend)
+{
+   unsigned i;
+
+   for (i = 0; i < sizeof(backend_names) / sizeof(backend_names[0]); i++) {
+      if (strcmp(name, backend_names[i].name) == 0) {
+         *backend = backend_names[i].backend;
+         return true;
+      }
+   }
+
+   return false;
+}
+
+const char*
+context_backend_name(enum context_backend backend)
+{
+   unsigned i;
+
+   for (i = 0; i < sizeof(backend_names) / sizeof(backend_names[0]); i++) {
+      if (backend_names[i].backend == backend)
+         return backend_names[i].name;
+   }
+
+   return "(unknown)";
+}
+
+static bool
+has_extension(const char *extensions,
+              const char *name)
+{
+   size_t len = strlen(name);
+   const char *ext = extensions;
+
+   if (extensions == NULL)
+      return false;
+
+   while ((ext = strstr(ext, name)) != NULL) {
+      if ((ext == extensions || ext[-1] == ' ') &&
+          (ext[len] == ' ' || ext[len] == '\0'))
+         return true;
+      ext += len;
+   }
+
+   return false;
+}
+
+/* Creates a context without any surface on @ctx->egl_display, that
+ * should be already set (and initialized) by the caller. */
+static bool
+egl_create_context(context *ctx)
+{
+   EGLConfig config = EGL_NO_CONFIG_KHR;
+   EGLint attribs[7] = { EGL_NONE };
+   const char *extensions;
+
+   extensions = eglQueryString(ctx->egl_display, EGL_EXTENSIONS);
+   if (!has_extension(extensions, "EGL_KHR_surfaceless_context")) {
+      fprintf(stderr, "EGL_KHR_surfaceless_context not supported.\n");
+      return false;
+   }
+
+   if (!has_extension(extensions, "EGL_KHR_no_config_context") &&
+       !has_extension(extensions, "EGL_MESA_configless_context")) {
+      static const EGLint config_attribs[] = {
+         EGL_SURFACE_TYPE, 0,
+         EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+         EGL_NONE
+      };
+      EGLint num_configs;
+
+      if (!eglChooseConfig(ctx->egl_display, config_attribs, &config,
+                           1, &num_configs) || num_configs == 0) {
+         fprintf(stderr, "No EGL config available.\n");
+         return false;
+      }
+   }
+
+   if (ctx->flags & CONTEXT_FLAG_NO_ERROR) {
+      if (!has_extension(extensions, "EGL_KHR_create_context_no_error")) {
+         fprintf(stderr, "EGL_KHR_create_context_no_error not supported.\n");
+         return false;
+      }
+      /* GL_KHR_no_error needs at least GL 2.0, and drivers (like Mesa)
+       * reject it if the default version (1.0) is requested. We still
+       * get the highest version available. */
+      attribs[0] = EGL_CONTEXT_MAJOR_VERSION_KHR;
+      attribs[1] = 2;
+      attribs[2] = EGL_CONTEXT_MINOR_VERSION_KHR;
+      attribs[3] = 0;
+      attribs[4] = EGL_CONTEXT_OPENGL_NO_ERROR_KHR;
+      attribs[5] = EGL_TRUE;
+      attribs[6] = EGL_NONE;
+   }
+
+   if (!eglBindAPI(EGL_OPENGL_API))
+      return false;
+
+   ctx->egl_context = eglCreateContext(ctx->egl_display, config,
+                                       EGL_NO_CONTEXT, attribs);
+
+   return ctx->egl_context != EGL_NO_CONTEXT;
+}
+
+static bool
+egl_initialize(context *ctx)
+{
+   EGLint major;
+   EGLint minor;
+
+   if (ctx->egl_display == EGL_NO_DISPLAY)
+      return false;
+
+   if (!eglInitialize(ctx->egl_display, &major, &minor)) {
+      ctx->egl_display = EGL_NO_DISPLAY;
+      return false;
+   }
+   ctx->owns_display = true;
+
+   return egl_create_context(ctx);
+}
+
+static EGLDisplay
+egl_get_platform_display(EGLenum platform,
+                         void *native_display)
+{
+   static PFNEGLGETPLATFORMDISPLAYEXTPROC get_platform_display = NULL;
+
+   if (!has_extension(eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS),
+                      "EGL_EXT_platform_base"))
+      return EGL_NO_DISPLAY;
+
+   if (get_platform_display == NULL) {
+      get_platform_display = (PFNEGLGETPLATFORMDISPLAYEXTPROC)
+         eglGetProcAddress("eglGetPlatformDisplayEXT");
+      if (get_platform_display == NULL)
+         return EGL_NO_DISPLAY;
+   }
+
+   return get_platform_display(platform, native_display, NULL);
+}
+
+static bool
+surfaceless_init(context *ctx)
+{
+   const char *client_extensions =
+      eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+
+   if (!has_extension(client_extensions, "EGL_MESA_platform_surfaceless"))
+      return false;
+
+   ctx->egl_display = egl_get_platform_display(EGL_PLATFORM_SURFACELESS_MESA,
+                                               EGL_DEFAULT_DISPLAY);
+
+   return egl_initialize(ctx);
+}
+
+static void
+backend_fini(context *ctx)
+{
+   if (ctx->egl_display != EGL_NO_DISPLAY) {
+      if (ctx->egl_context != EGL_NO_CONTEXT &&
+          eglGetCurrentContext() == ctx->egl_context)
+         eglMakeCurrent(ctx->egl_display, EGL_NO_SURFACE, EGL_NO_SURFACE,
+                        EGL_NO_CONTEXT);
+      if (ctx->egl_context != EGL_NO_CONTEXT)
+         eglDestroyContext(ctx->egl_display, ctx->egl_context);
+      if (ctx->owns_display)
+         eglTerminate(ctx->egl_display);
+      ctx->egl_display = EGL_NO_DISPLAY;
+      ctx->egl_context = EGL_NO_CONTEXT;
+   }
+
+#ifdef HAVE_GBM
+   if (ctx->gbm != NULL) {
+      gbm_device_destroy(ctx->gbm);
+      ctx->gbm = NULL;
+   }
+   if (ctx->gbm_fd >= 0) {
+      close(ctx->gbm_fd);
+      ctx->gbm_fd = -1;
+   }
+#endif
+
+#ifdef HAVE_OSMESA
+   if (ctx->osmesa_context != NULL) {
+      OSMesaDestroyContext(ctx->osmesa_context);
+      ctx->osmesa_context = NULL;
+   }
+#endif
+
+   if (ctx->glut_window != 0) {
+      glutDestroyWindow(ctx->glut_window);
+      ctx->glut_window = 0;
+   }
+}
+
+#ifdef HAVE_GBM
+static bool
+gbm_init_node(context *ctx,
+              const char *path)
+{
+   ctx->gbm_fd = open(path, O_RDWR | O_CLOEXEC);
+   if (ctx->gbm_fd < 0)
+      return false;
+
+   ctx->gbm = gbm_create_device(ctx->gbm_fd);
+   if (ctx->gbm == NULL)
+      return false;
+
+   ctx->egl_display = egl_get_platform_display(EGL_PLATFORM_GBM_KHR,
+                                               ctx->gbm);
+
+   return egl_initialize(ctx);
+}
+#endif
+
+/* Uses the first render node that a GL context can be created on, as
+ * the first ones can belong to a device without GL support, or that
+ * we can't open */
+static bool
+gbm_init(context *ctx)
+{
+#ifdef HAVE_GBM
+   const char *client_extensions =
+      eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+   glob_t nodes;
+   bool result = false;
+   size_t i;
+
+   if (!has_extension(client_extensions, "EGL_KHR_platform_gbm") &&
+       !has_extension(client_extensions, "EGL_MESA_platform_gbm"))
+      return false;
+
+   if (glob(GBM_RENDER_NODES, 0, NULL, &nodes) != 0)
+      return false;
+
+   for (i = 0; !result && i < nodes.gl_pathc; i++) {
+      result = gbm_init_node(ctx, nodes.gl_pathv[i]);
+      if (!result) {
+         backend_fini(ctx);
+         ctx->owns_display = false;
+      }
+   }
+   globfree(&nodes);
+
+   return result;
+#else
+   return false;
+#endif
+}
+
+static bool
+osmesa_init(context *ctx)
+{
+#ifdef HAVE_OSMESA
+   if (ctx->flags & CONTEXT_FLAG_NO_ERROR)
+      return false;
+
+   ctx->osmesa_context = OSMesaCreateContextExt(OSMESA_RGBA, 0, 0, 0, NULL);
+   return ctx->osmesa_context != NULL;
+#else
+   return false;
+#endif
+}
+
+static bool
+glut_init(context *ctx,
+          int argc,
+          char *argv[])
+{
+   if (ctx->flags & CONTEXT_FLAG_NO_ERROR)
+      return false;
+
+   glutInit(&argc, argv);
+   glutInitWindowPosition(100, 0);
+   /* FIXME: check for freeglut and use initcontexprofile */
+   glutInitWindowSize(WINDOW_WIDTH, WINDOW_HEIGHT);
+   glutInitDisplayMode(GLUT_RGBA | GLUT_DOUBLE);
+
+   ctx->glut_window = glutCreateWindow(argv[0]);
+
+   return ctx->glut_window != GL_FALSE;
+}
+
+static bool
+backend_init(context *ctx,
+             int argc,
+             char *argv[])
+{
+   switch (ctx->backend) {
+   case CONTEXT_BACKEND_SURFACELESS:
+      return surfaceless_init(ctx);
+   case CONTEXT_BACKEND_GBM:
+      return gbm_init(ctx);
+   case CONTEXT_BACKEND_OSMESA:
+      return osmesa_init(ctx);
+   case CONTEXT_BACKEND_GLUT:
+      return glut_init(ctx, argc, argv);
+   default:
+      return false;
+   }
+}
+
+/*
+ * Creates a new context using @backend, and makes it current. If
+ * @backend is CONTEXT_BACKEND_AUTO, all the available backends are
+ * tried in order, from the lighter to the heavier one. Returns NULL
+ * if it was not possible to create the context.
+ *
+ * With CONTEXT_FLAG_NO_ERROR on @flags, the context is created with
+ * GL_KHR_no_error, so the driver can skip the validation of the
+ * queries. Only the EGL backends support it.
+ */
+context*
+context_new(enum context_backend backend,
+            unsigned flags,
+            int argc,
+            char *argv[])
+{
+   context *result;
+   enum context_backend first = backend;
+   enum context_backend last = backend;
+   enum context_backend current;
+
+   if (backend == CONTEXT_BACKEND_AUTO) {
+      first = CONTEXT_BACKEND_SURFACELESS;
+      last = CONTEXT_BACKEND_GLUT;
+   }
+
+   result = (context*) calloc(1, sizeof(context));
+
+   for (current = first; current <= last; current++) {
+      if (backend == CONTEXT_BACKEND_AUTO &&
+          current == CONTEXT_BACKEND_GLUT && getenv("DISPLAY") == NULL)
+         continue;
+
+      result->backend = current;
+      result->flags = flags;
+      result->egl_display = EGL_NO_DISPLAY;
+      result->egl_context = EGL_NO_CONTEXT;
+#ifdef HAVE_GBM
+      result->gbm_fd = -1;
+#endif
+
+      if (backend_init(result, argc, argv) &&
+          context_make_current(result))
+         return result;
+
+      backend_fini(result);
+   }
+
+   free(result);
+
+   return NULL;
+}
+
+/*
+ * Creates a new context using the same backend (and display, if any)
+ * and flags as @ctx. Unlike context_new, the new context is not made
+ * current, so it can be created on one thread and used on another
+ * one. Returns NULL if the backend doesn't support more than one
+ * context.
+ */
+context*
+context_new_sibling(const context *ctx)
+{
+   context *result;
+   bool success = false;
+
+   result = (context*) calloc(1, sizeof(context));
+   result->backend = ctx->backend;
+   result->flags = ctx->flags;
+   result->egl_display = EGL_NO_DISPLAY;
+   result->egl_context = EGL_NO_CONTEXT;
+#ifdef HAVE_GBM
+   result->gbm_fd = -1;
+#endif
+
+   switch (ctx->backend) {
+   case CONTEXT_BACKEND_SURFACELESS:
+   case CONTEXT_BACKEND_GBM:
+      result->egl_display = ctx->egl_display;
+      success = egl_create_context(result);
+      break;
+   case CONTEXT_BACKEND_OSMESA:
+      success = osmesa_init(result);
+      break;
+   default:
+      /* GLUT would need a window per context */
+      break;
+   }
+
+   if (!success)
+      context_clear(&result);
+
+   return result;
+}
+
+enum context_backend
+context_get_backend(const context *ctx)
+{
+   return ctx->backend;
+}
+
+bool
+context_make_current(context *ctx)
+{
+   switch (ctx->backend) {
+   case CONTEXT_BACKEND_SURFACELESS:
+   case CONTEXT_BACKEND_GBM:
+      return eglMakeCurrent(ctx->egl_display, EGL_NO_SURFACE, EGL_NO_SURFACE,
+                            ctx->egl_context);
+#ifdef HAVE_OSMESA
+   case CONTEXT_BACKEND_OSMESA:
+      return OSMesaMakeCurrent(ctx->osmesa_context, ctx->osmesa_buffer,
+                               GL_UNSIGNED_BYTE, 1, 1);
+#endif
+   case CONTEXT_BACKEND_GLUT:
+      glutSetWindow(ctx->glut_window);
+      return true;
+   default:
+      return false;
+   }
+}
+
+/*
+ * Loads the GL entry points for the context current on the calling
+ * thread, created with @backend, or CONTEXT_BACKEND_AUTO if it was not
+ * created by context_new. Returns false, after printing the error, if
+ * GLEW can't load them.
+ */
+bool
+context_load_entry_points(enum context_backend backend)
+{
+   GLenum err;
+
+   glewExperimental = GL_TRUE;
+   err = glewInit();
+#ifdef GLEW_ERROR_NO_GLX_DISPLAY
+   /* GLX builds of GLEW complain if there is no GLX display, even if
+    * the GL entry points were properly loaded for an EGL context */
+   if (err == GLEW_ERROR_NO_GLX_DISPLAY && backend != CONTEXT_BACKEND_GLUT)
+      err = GLEW_OK;
+#endif
+   if (err != GLEW_OK) {
+      fprintf(stderr, "Error calling glewInit(): %s\n",
+              glewGetErrorString(err));
+      return false;
+   }
+
+   return true;
+}
+
+/*
+ * Detaches @ctx from the calling thread, so it can be destroyed from
+ * another one.
+ */
+void
+context_release_current(context *ctx)
+{
+   switch (ctx->backend) {
+   case CONTEXT_BACKEND_SURFACELESS:
+   case CONTEXT_BACKEND_GBM:
+      eglMakeCurrent(ctx->egl_display, EGL_NO_SURFACE, EGL_NO_SURFACE,
+                     EGL_NO_CONTEXT);
+      eglReleaseThread();
+      break;
+#ifdef HAVE_OSMESA
+   case CONTEXT_BACKEND_OSMESA:
+      OSMesaMakeCurrent(NULL, NULL, GL_UNSIGNED_BYTE, 0, 0);
+      break;
+#endif
+   default:
+      break;
+   }
+}
+
+/*
+ * Frees @ctx, and sets its value to NULL.
+ */
+void
+context_clear(context **ctx)
+{
+   context *_ctx = *ctx;
+
+   if (_ctx == NULL)
+      return;
+
+   backend_fini(_ctx);
+
+   free(_ctx);
+   *ctx = NULL;
+}
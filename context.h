@@ -0,0 +1,67 @@
+/*
+ * Copyright © 2016 Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+#ifndef CONTEXT_H
+#define CONTEXT_H
+
+#include <stdbool.h>
+
+/* The different ways to get a GL context. All the queries done by
+ * query2-info are context queries, so only the GLUT backend creates a
+ * window. The rest of them just create a context, without any
+ * drawable, so they can run on machines without a display server. */
+enum context_backend {
+   CONTEXT_BACKEND_AUTO,
+   CONTEXT_BACKEND_SURFACELESS,
+   CONTEXT_BACKEND_GBM,
+   CONTEXT_BACKEND_OSMESA,
+   CONTEXT_BACKEND_GLUT,
+};
+
+/* Flags for context_new */
+#define CONTEXT_FLAG_NO_ERROR (1 << 0)
+
+typedef struct _context context;
+
+bool context_backend_from_name(const char *name,
+                               enum context_backend *backend);
+
+const char* context_backend_name(enum context_backend backend);
+
+context* context_new(enum context_backend backend,
+                     unsigned flags,
+                     int argc,
+                     char *argv[]);
+
+context* context_new_sibling(const context *ctx);
+
+enum context_backend context_get_backend(const context *ctx);
+
+bool context_make_current(context *ctx);
+
+bool context_load_entry_points(enum context_backend backend);
+
+void context_release_current(context *ctx);
+
+void context_clear(context **ctx);
+
+#endif /* CONTEXT_H */
@@ -0,0 +1,585 @@
+/*
+ * Copyright © 2016 Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+/**
+ * Read-only database with the results of a sweep, indexed by
+ * pname/target/internalformat.
+ *
+ * The results are stored as a dense 3-D array of result_db_cell, with
+ * one cell per pname, target and internalformat queried, in that
+ * order, so looking one up is a single indexed load once their
+ * positions are known. Those positions are found with a direct-mapped
+ * index per dimension: a table, with a power of two size, indexed by
+ * the low bits of the enum, that the writer makes big enough to not
+ * have collisions. The values of the results with more than one value
+ * go to an overflow region. The results the driver didn't write, as
+ * the query raised an error or has no values (GL_SAMPLES without
+ * sample counts), are not stored, so their cells are empty.
+ *
+ * The layout is:
+ *
+ *  - result_db_header, with the sizes of each dimension and index, and
+ *    the offset and size of each section. All the sections are 8 bytes
+ *    aligned.
+ *  - The GL fingerprint of the driver, NUL terminated.
+ *  - The enums of each dimension, as uint32_t.
+ *  - The index of each dimension, as uint16_t positions on the enums
+ *    of the dimension, or UINT16_MAX for the unused slots.
+ *  - The cells of the 64-bit results.
+ *  - The cells of the 32-bit results, with the same layout, if the
+ *    sweep was run with -b, or an empty section otherwise.
+ *  - The overflow values of both, as int64_t.
+ *
+ * The 32-bit results are stored on their own, as the driver doesn't
+ * have to return the 64-bit value truncated or clamped when it doesn't
+ * fit. Everything is stored with the native endianness.
+ */
+#include "database.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "file-io.h"
+#include "output.h"
+
+#define RESULT_DB_MAGIC "Q2IRESDB"
+#define RESULT_DB_VERSION 3
+
+/* Value of the unused slots of the indices */
+#define INDEX_UNUSED UINT16_MAX
+
+enum result_db_dimension {
+   DIMENSION_PNAME,
+   DIMENSION_TARGET,
+   DIMENSION_INTERNALFORMAT,
+   DIMENSION_COUNT,
+};
+
+enum result_db_section {
+   SECTION_FINGERPRINT,
+   SECTION_ENUMS,
+   SECTION_INDICES = SECTION_ENUMS + DIMENSION_COUNT,
+   SECTION_CELLS = SECTION_INDICES + DIMENSION_COUNT,
+   SECTION_CELLS32,
+   SECTION_OVERFLOW,
+   SECTION_COUNT,
+};
+
+typedef struct _result_db_header {
+   char magic[8];
+   uint32_t version;
+   uint32_t num_overflow_values;
+   uint32_t dimension_sizes[DIMENSION_COUNT];
+   /* Number of slots of each index, always a power of two */
+   uint32_t index_sizes[DIMENSION_COUNT];
+   file_section sections[SECTION_COUNT];
+} result_db_header;
+
+struct _result_db {
+   const char *data;
+   size_t size;
+   const result_db_header *header;
+   const uint32_t *enums[DIMENSION_COUNT];
+   const uint16_t *indices[DIMENSION_COUNT];
+   uint32_t index_masks[DIMENSION_COUNT];
+   const result_db_cell *cells;
+   /* NULL if the database has no 32-bit results */
+   const result_db_cell *cells32;
+   const int64_t *overflow;
+};
+
+struct _result_db_writer {
+   char *path;
+   char *fingerprint;
+   uint32_t *enums[DIMENSION_COUNT];
+   uint16_t *indices[DIMENSION_COUNT];
+   uint32_t dimension_sizes[DIMENSION_COUNT];
+   uint32_t index_sizes[DIMENSION_COUNT];
+   result_db_cell *cells;
+   /* Allocated with the first 32-bit result */
+   result_db_cell *cells32;
+   int64_t *overflow;
+   uint32_t num_overflow_values;
+   uint32_t overflow_capacity;
+};
+
+/* Position of @value on the dimension, or -1 if it is not there */
+static inline int
+find_position(const uint32_t *enums,
+              const uint16_t *index,
+              uint32_t index_mask,
+              GLenum value)
+{
+   uint16_t position = index[value & index_mask];
+
+   if (position == INDEX_UNUSED || enums[position] != value)
+      return -1;
+
+   return position;
+}
+
+static bool
+section_is_valid(const result_db *db,
+                 enum result_db_section section,
+                 uint64_t expected_size)
+{
+   return file_section_is_valid(&db->header->sections[section], db->size,
+                                expected_size);
+}
+
+static const void*
+section_data(const result_db *db,
+             enum result_db_section section)
+{
+   return file_section_data(db->data, &db->header->sections[section]);
+}
+
+/* Checks that the values of @cells are on the overflow region */
+static bool
+cells_are_valid(const result_db_cell *cells,
+                uint64_t num_cells,
+                uint32_t num_overflow_values)
+{
+   uint64_t i;
+
+   for (i = 0; i < num_cells; i++) {
+      const result_db_cell *cell = &cells[i];
+
+      if (cell->num_values > QUERY_RESULT_MAX_VALUES ||
+          (cell->num_values > 1 &&
+           (uint64_t) cell->overflow + cell->num_values >
+           num_overflow_values))
+         return false;
+   }
+
+   return true;
+}
+
+/* Checks the header of @db, and sets up the pointers to the sections.
+ * The indices and cells are checked too, so a lookup never reads out
+ * of the file. */
+static bool
+result_db_init(result_db *db)
+{
+   const result_db_header *header = db->header;
+   uint64_t fingerprint_size;
+   uint64_t num_cells = 1;
+   uint64_t i;
+   unsigned d;
+
+   if (db->size < sizeof(result_db_header) ||
+       memcmp(header->magic, RESULT_DB_MAGIC, sizeof(header->magic)) != 0 ||
+       header->version != RESULT_DB_VERSION)
+      return false;
+
+   fingerprint_size = header->sections[SECTION_FINGERPRINT].size;
+   if (fingerprint_size == 0 ||
+       !section_is_valid(db, SECTION_FINGERPRINT, fingerprint_size) ||
+       db->data[header->sections[SECTION_FINGERPRINT].offset +
+                fingerprint_size - 1] != '\0')
+      return false;
+
+   for (d = 0; d < DIMENSION_COUNT; d++) {
+      uint32_t size = header->dimension_sizes[d];
+      uint32_t index_size = header->index_sizes[d];
+
+      if (size >= INDEX_UNUSED || index_size == 0 ||
+          (index_size & (index_size - 1)) != 0 ||
+          !section_is_valid(db, SECTION_ENUMS + d,
+                            (uint64_t) size * sizeof(uint32_t)) ||
+          !section_is_valid(db, SECTION_INDICES + d,
+                            (uint64_t) index_size * sizeof(uint16_t)))
+         return false;
+
+      db->enums[d] = section_data(db, SECTION_ENUMS + d);
+      db->indices[d] = section_data(db, SECTION_INDICES + d);
+      db->index_masks[d] = index_size - 1;
+      for (i = 0; i < index_size; i++) {
+         if (db->indices[d][i] != INDEX_UNUSED && db->indices[d][i] >= size)
+            return false;
+      }
+
+      num_cells *= size;
+   }
+
+   if (!section_is_valid(db, SECTION_CELLS,
+                         num_cells * sizeof(result_db_cell)) ||
+       !(section_is_valid(db, SECTION_CELLS32, 0) ||
+         section_is_valid(db, SECTION_CELLS32,
+                          num_cells * sizeof(result_db_cell))) ||
+       !section_is_valid(db, SECTION_OVERFLOW,
+                         (uint64_t) header->num_overflow_values *
+                         sizeof(int64_t)))
+      return false;
+
+   db->cells = section_data(db, SECTION_CELLS);
+   if (header->sections[SECTION_CELLS32].size > 0)
+      db->cells32 = section_data(db, SECTION_CELLS32);
+   db->overflow = section_data(db, SECTION_OVERFLOW);
+
+   return cells_are_valid(db->cells, num_cells,
+                          header->num_overflow_values) &&
+      (db->cells32 == NULL ||
+       cells_are_valid(db->cells32, num_cells,
+                       header->num_overflow_values));
+}
+
+/*
+ * Maps the database at @path. Returns NULL if it can't be read or it
+ * is not a valid one.
+ */
+result_db*
+result_db_open(const char *path)
+{
+   result_db *db;
+   const void *data;
+   size_t size;
+
+   data = file_map(path, &size);
+   if (data == NULL)
+      return NULL;
+
+   db = (result_db*) calloc(1, sizeof(result_db));
+   db->data = data;
+   db->size = size;
+   db->header = data;
+
+   if (!result_db_init(db))
+      result_db_clear(&db);
+
+   return db;
+}
+
+/*
+ * Unmaps @db, and sets its value to NULL.
+ */
+void
+result_db_clear(result_db **db)
+{
+   result_db *_db = *db;
+
+   if (_db == NULL)
+      return;
+
+   file_unmap(_db->data, _db->size);
+   free(_db);
+   *db = NULL;
+}
+
+/*
+ * Returns the GL fingerprint of the driver that answered the queries,
+ * to be compared with the one of the driver being used.
+ */
+const char*
+result_db_get_fingerprint(const result_db *db)
+{
+   return section_data(db, SECTION_FINGERPRINT);
+}
+
+/*
+ * Returns the cell of @pname, @target and @internalformat, or NULL if
+ * they are not on the database, or they were not queried. Without
+ * @testing64 it is the one of the 32-bit query, if the database has
+ * them, and the one of the 64-bit query otherwise, that the caller
+ * has to check fits on 32 bits.
+ */
+const result_db_cell*
+result_db_lookup(const result_db *db,
+                 bool testing64,
+                 GLenum pname,
+                 GLenum target,
+                 GLenum internalformat)
+{
+   const result_db_header *header = db->header;
+   const result_db_cell *cell;
+   int p = find_position(db->enums[DIMENSION_PNAME],
+                         db->indices[DIMENSION_PNAME],
+                         db->index_masks[DIMENSION_PNAME], pname);
+   int t = find_position(db->enums[DIMENSION_TARGET],
+                         db->indices[DIMENSION_TARGET],
+                         db->index_masks[DIMENSION_TARGET], target);
+   int f = find_position(db->enums[DIMENSION_INTERNALFORMAT],
+                         db->indices[DIMENSION_INTERNALFORMAT],
+                         db->index_masks[DIMENSION_INTERNALFORMAT],
+                         internalformat);
+
+   if (p < 0 || t < 0 || f < 0)
+      return NULL;
+
+   cell = &(testing64 || db->cells32 == NULL ? db->cells : db->cells32)
+      [((size_t) p * header->dimension_sizes[DIMENSION_TARGET] + t) *
+       header->dimension_sizes[DIMENSION_INTERNALFORMAT] + f];
+
+   return cell->num_values > 0 ? cell : NULL;
+}
+
+/*
+ * Returns the cell->num_values values of @cell.
+ */
+const int64_t*
+result_db_get_values(const result_db *db,
+                     const result_db_cell *cell)
+{
+   if (cell->num_values > 1)
+      return &db->overflow[cell->overflow];
+
+   return &cell->value;
+}
+
+/* Builds the smallest index without collisions for @enums. Returns
+ * false if there is none with up to 64K slots. */
+static bool
+build_index(const uint32_t *enums,
+            uint32_t num_enums,
+            uint16_t **index,
+            uint32_t *index_size)
+{
+   uint32_t size = 1;
+   uint32_t i;
+
+   while (size < num_enums)
+      size *= 2;
+
+   for (; size <= (1 << 16); size *= 2) {
+      bool collision = false;
+
+      *index = (uint16_t*) malloc(size * sizeof(uint16_t));
+      memset(*index, 0xff, size * sizeof(uint16_t));
+      for (i = 0; i < num_enums && !collision; i++) {
+         uint16_t *slot = &(*index)[enums[i] & (size - 1)];
+
+         collision = *slot != INDEX_UNUSED;
+         *slot = i;
+      }
+
+      if (!collision) {
+         *index_size = size;
+         return true;
+      }
+      free(*index);
+   }
+
+   *index = NULL;
+   return false;
+}
+
+/*
+ * Starts a database for @path, with the results of querying @pnames,
+ * @targets and @internalformats, on the driver with the GL
+ * @fingerprint. Nothing is written until result_db_writer_finish.
+ * Returns NULL if any of the enums can't be indexed.
+ */
+result_db_writer*
+result_db_writer_new(const char *path,
+                     const char *fingerprint,
+                     const GLenum *pnames,
+                     unsigned num_pnames,
+                     const GLenum *targets,
+                     unsigned num_targets,
+                     const GLenum *internalformats,
+                     unsigned num_internalformats)
+{
+   result_db_writer *writer;
+   const GLenum *enums[DIMENSION_COUNT] = {
+      pnames, targets, internalformats,
+   };
+   const unsigned sizes[DIMENSION_COUNT] = {
+      num_pnames, num_targets, num_internalformats,
+   };
+   unsigned d;
+   unsigned i;
+
+   writer = (result_db_writer*) calloc(1, sizeof(result_db_writer));
+   writer->path = strdup(path);
+   writer->fingerprint = strdup(fingerprint ? fingerprint : "");
+
+   for (d = 0; d < DIMENSION_COUNT; d++) {
+      writer->dimension_sizes[d] = sizes[d];
+      writer->enums[d] = (uint32_t*) malloc(sizes[d] * sizeof(uint32_t));
+      for (i = 0; i < sizes[d]; i++)
+         writer->enums[d][i] = enums[d][i];
+
+      if (!build_index(writer->enums[d], sizes[d], &writer->indices[d],
+                       &writer->index_sizes[d])) {
+         fprintf(stderr, "Error indexing the enums of the database.\n");
+         while (d-- > 0) {
+            free(writer->enums[d]);
+            free(writer->indices[d]);
+         }
+         free(writer->fingerprint);
+         free(writer->path);
+         free(writer);
+         return NULL;
+      }
+   }
+
+   writer->cells = (result_db_cell*)
+      calloc((size_t) num_pnames * num_targets * num_internalformats,
+             sizeof(result_db_cell));
+
+   return writer;
+}
+
+/*
+ * Adds @result, ignoring the ones not for the pnames, targets and
+ * internalformats of the database, and the ones the driver didn't
+ * write: the sweep sets the first value to -1 before each query, that
+ * no pname returns, and the driver leaves it as is when the query
+ * raises an error or has no values.
+ */
+void
+result_db_writer_add(result_db_writer *writer,
+                     const query_result *result)
+{
+   result_db_cell *cells;
+   result_db_cell *cell;
+   int p;
+   int t;
+   int f;
+
+   if (result->num_values < 1 || result->values[0] == -1)
+      return;
+
+   p = find_position(writer->enums[DIMENSION_PNAME],
+                     writer->indices[DIMENSION_PNAME],
+                     writer->index_sizes[DIMENSION_PNAME] - 1, result->pname);
+   t = find_position(writer->enums[DIMENSION_TARGET],
+                     writer->indices[DIMENSION_TARGET],
+                     writer->index_sizes[DIMENSION_TARGET] - 1,
+                     result->target);
+   f = find_position(writer->enums[DIMENSION_INTERNALFORMAT],
+                     writer->indices[DIMENSION_INTERNALFORMAT],
+                     writer->index_sizes[DIMENSION_INTERNALFORMAT] - 1,
+                     result->internalformat);
+   if (p < 0 || t < 0 || f < 0)
+      return;
+
+   if (result->testing64) {
+      cells = writer->cells;
+   } else {
+      if (writer->cells32 == NULL)
+         writer->cells32 = (result_db_cell*)
+            calloc((size_t) writer->dimension_sizes[DIMENSION_PNAME] *
+                   writer->dimension_sizes[DIMENSION_TARGET] *
+                   writer->dimension_sizes[DIMENSION_INTERNALFORMAT],
+                   sizeof(result_db_cell));
+      cells = writer->cells32;
+   }
+
+   cell = &cells[((size_t) p * writer->dimension_sizes[DIMENSION_TARGET] +
+                  t) * writer->dimension_sizes[DIMENSION_INTERNALFORMAT] + f];
+   cell->value = result->values[0];
+   cell->num_values = result->num_values;
+
+   if (result->num_values > 1) {
+      while (writer->num_overflow_values + result->num_values >
+             writer->overflow_capacity) {
+         writer->overflow_capacity = writer->overflow_capacity ?
+            writer->overflow_capacity * 2 : 256;
+         writer->overflow = (int64_t*)
+            realloc(writer->overflow,
+                    writer->overflow_capacity * sizeof(int64_t));
+      }
+
+      cell->overflow = writer->num_overflow_values;
+      memcpy(&writer->overflow[writer->num_overflow_values], result->values,
+             result->num_values * sizeof(int64_t));
+      writer->num_overflow_values += result->num_values;
+   }
+}
+
+/*
+ * Writes the database, replacing any previous one at the path given
+ * to result_db_writer_new, and frees @writer. Returns false if there
+ * was any error.
+ */
+bool
+result_db_writer_finish(result_db_writer **writer)
+{
+   result_db_writer *_writer = *writer;
+   result_db_header header;
+   const void *sections[SECTION_COUNT];
+   atomic_file *file;
+   unsigned i;
+   bool success = false;
+
+   memset(&header, 0, sizeof(header));
+   memcpy(header.magic, RESULT_DB_MAGIC, sizeof(header.magic));
+   header.version = RESULT_DB_VERSION;
+   header.num_overflow_values = _writer->num_overflow_values;
+
+   sections[SECTION_FINGERPRINT] = _writer->fingerprint;
+   header.sections[SECTION_FINGERPRINT].size =
+      strlen(_writer->fingerprint) + 1;
+   for (i = 0; i < DIMENSION_COUNT; i++) {
+      header.dimension_sizes[i] = _writer->dimension_sizes[i];
+      header.index_sizes[i] = _writer->index_sizes[i];
+      sections[SECTION_ENUMS + i] = _writer->enums[i];
+      header.sections[SECTION_ENUMS + i].size =
+         _writer->dimension_sizes[i] * sizeof(uint32_t);
+      sections[SECTION_INDICES + i] = _writer->indices[i];
+      header.sections[SECTION_INDICES + i].size =
+         _writer->index_sizes[i] * sizeof(uint16_t);
+   }
+   sections[SECTION_CELLS] = _writer->cells;
+   header.sections[SECTION_CELLS].size =
+      (size_t) _writer->dimension_sizes[DIMENSION_PNAME] *
+      _writer->dimension_sizes[DIMENSION_TARGET] *
+      _writer->dimension_sizes[DIMENSION_INTERNALFORMAT] *
+      sizeof(result_db_cell);
+   sections[SECTION_CELLS32] = _writer->cells32;
+   if (_writer->cells32 != NULL)
+      header.sections[SECTION_CELLS32].size =
+         header.sections[SECTION_CELLS].size;
+   sections[SECTION_OVERFLOW] = _writer->overflow;
+   header.sections[SECTION_OVERFLOW].size =
+      _writer->num_overflow_values * sizeof(int64_t);
+
+   file_sections_set_offsets(header.sections, SECTION_COUNT, sizeof(header));
+
+   file = atomic_file_new(_writer->path);
+   if (file != NULL) {
+      file_sections_append(atomic_file_get_output(file), &header,
+                           sizeof(header), header.sections, sections,
+                           SECTION_COUNT);
+      success = atomic_file_finish(&file);
+   }
+
+   if (!success)
+      fprintf(stderr, "Error writing database `%s'.\n", _writer->path);
+
+   for (i = 0; i < DIMENSION_COUNT; i++) {
+      free(_writer->enums[i]);
+      free(_writer->indices[i]);
+   }
+   free(_writer->cells);
+   free(_writer->cells32);
+   free(_writer->overflow);
+   free(_writer->fingerprint);
+   free(_writer->path);
+   free(_writer);
+   *writer = NULL;
+
+   return success;
+}
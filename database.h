@@ -0,0 +1,83 @@
+/*
+ * Copyright © 2016 Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+#ifndef DATABASE_H
+#define DATABASE_H
+
+#include <GL/glew.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "util.h"
+
+/* Read-only database with the results of a sweep, to be mapped by
+ * applications that want the answers of glGetInternalformat*v without
+ * querying the driver. See database.c for the layout. */
+
+/* Outcome of one pname/target/internalformat, with the num_values
+ * values the driver wrote. The ones with more than one value
+ * (GL_SAMPLES) have them on the overflow region, and the ones not
+ * queried, as unsupported with -f, or that the driver didn't write, as
+ * they raised an error, have no values. */
+typedef struct _result_db_cell {
+   int64_t value;
+   /* Index of the first value on the overflow region, if num_values
+    * is greater than 1 */
+   uint32_t overflow;
+   uint16_t num_values;
+   uint16_t padding;
+} result_db_cell;
+
+typedef struct _result_db result_db;
+
+result_db* result_db_open(const char *path);
+
+void result_db_clear(result_db **db);
+
+const char* result_db_get_fingerprint(const result_db *db);
+
+const result_db_cell* result_db_lookup(const result_db *db,
+                                       bool testing64,
+                                       GLenum pname,
+                                       GLenum target,
+                                       GLenum internalformat);
+
+const int64_t* result_db_get_values(const result_db *db,
+                                    const result_db_cell *cell);
+
+typedef struct _result_db_writer result_db_writer;
+
+result_db_writer* result_db_writer_new(const char *path,
+                                       const char *fingerprint,
+                                       const GLenum *pnames,
+                                       unsigned num_pnames,
+                                       const GLenum *targets,
+                                       unsigned num_targets,
+                                       const GLenum *internalformats,
+                                       unsigned num_internalformats);
+
+void result_db_writer_add(result_db_writer *writer,
+                          const query_result *result);
+
+bool result_db_writer_finish(result_db_writer **writer);
+
+#endif /* DATABASE_H */
@@ -0,0 +1,236 @@
+/*
+ * Copyright © 2016 Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+/**
+ * Detection of the GL errors caused by the queries.
+ *
+ * Calling glGetError after each query can be a round trip to the
+ * driver, so there are modes that avoid it. The state of the query
+ * being executed (the cell) is kept per thread, as each thread has its
+ * own context, and the debug callback is called on the thread that
+ * caused the error when GL_DEBUG_OUTPUT_SYNCHRONOUS is enabled.
+ */
+#include "error-tracking.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "timeline.h"
+#include "trace.h"
+#include "util.h"
+#include "util-string.h"
+
+typedef struct _error_cell {
+   unsigned first_cell;
+   unsigned cell;
+   GLenum pname;
+   GLenum target;
+   GLenum internalformat;
+   int testing64;
+   /* Error reported by the debug callback since the last check */
+   bool error;
+} error_cell;
+
+static enum error_mode requested_mode = ERROR_MODE_SYNC;
+
+static __thread enum error_mode current_mode = ERROR_MODE_SYNC;
+static __thread error_cell current_cell;
+
+static const struct {
+   const char *name;
+   enum error_mode mode;
+} mode_names[] = {
+   { "sync", ERROR_MODE_SYNC },
+   { "debug", ERROR_MODE_DEBUG },
+   { "batched", ERROR_MODE_BATCHED },
+   { "none", ERROR_MODE_NONE },
+};
+
+bool
+error_mode_from_name(const char *name,
+                     enum error_mode *mode)
+{
+   unsigned i;
+
+   for (i = 0; i < sizeof(mode_names) / sizeof(mode_names[0]); i++) {
+      if (strcmp(name, mode_names[i].name) == 0) {
+         *mode = mode_names[i].mode;
+         return true;
+      }
+   }
+
+   return false;
+}
+
+/*
+ * Sets the mode used by the contexts initialized from now on.
+ */
+void
+error_tracking_set_mode(enum error_mode mode)
+{
+   requested_mode = mode;
+}
+
+static void GLAPIENTRY
+debug_callback(GLenum source,
+               GLenum type,
+               GLuint id,
+               GLenum severity,
+               GLsizei length,
+               const GLchar *message,
+               const void *user_data)
+{
+   if (type != GL_DEBUG_TYPE_ERROR)
+      return;
+
+   current_cell.error = true;
+   fprintf(stderr, "gl_error in cell %u (%s, %s, %s, %s): %s\n",
+           current_cell.cell,
+           current_cell.testing64 ? "64 bit" : "32 bit",
+           util_get_gl_enum_name(current_cell.pname),
+           util_get_gl_enum_name(current_cell.target),
+           util_get_gl_enum_name(current_cell.internalformat),
+           message);
+}
+
+/*
+ * Sets up the error tracking for the current context, on the calling
+ * thread. If the debug mode was requested, but GL_KHR_debug is not
+ * available, it falls back to the batched mode. Returns the mode being
+ * used.
+ */
+enum error_mode
+error_tracking_init_context(void)
+{
+   current_mode = requested_mode;
+
+   if (current_mode == ERROR_MODE_DEBUG) {
+      if (!glewIsSupported("GL_KHR_debug")) {
+         current_mode = ERROR_MODE_BATCHED;
+      } else {
+         glEnable(GL_DEBUG_OUTPUT);
+         glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+         glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DONT_CARE,
+                               0, NULL, GL_FALSE);
+         glDebugMessageControl(GL_DONT_CARE, GL_DEBUG_TYPE_ERROR,
+                               GL_DONT_CARE, 0, NULL, GL_TRUE);
+         glDebugMessageCallback(debug_callback, NULL);
+      }
+   }
+
+   return current_mode;
+}
+
+/*
+ * Starts a chunk of queries, for @pname and @target, with the first
+ * one being the cell @first_cell.
+ */
+void
+error_tracking_begin_chunk(unsigned first_cell,
+                           GLenum pname,
+                           GLenum target)
+{
+   current_cell.first_cell = first_cell;
+   current_cell.cell = first_cell;
+   current_cell.pname = pname;
+   current_cell.target = target;
+   current_cell.internalformat = GL_NONE;
+   current_cell.testing64 = 0;
+   current_cell.error = false;
+}
+
+/*
+ * Tags the queries done from now on as the ones of @cell, querying
+ * @internalformat with the width given by @testing64.
+ */
+void
+error_tracking_set_cell(unsigned cell,
+                        GLenum internalformat,
+                        int testing64)
+{
+   current_cell.cell = cell;
+   current_cell.internalformat = internalformat;
+   current_cell.testing64 = testing64;
+}
+
+/*
+ * Checks if there was an error since the last check. On the batched
+ * mode it is not possible to know it without calling glGetError, so
+ * it always returns false, as on the none mode.
+ */
+bool
+error_tracking_check_cell_at(const char *file,
+                             int line)
+{
+   bool result;
+
+   switch (current_mode) {
+   case ERROR_MODE_SYNC:
+      return check_ogl_error((char*) file, line);
+   case ERROR_MODE_DEBUG:
+      result = current_cell.error;
+      current_cell.error = false;
+      return result;
+   default:
+      return false;
+   }
+}
+
+/*
+ * Finishes the current chunk. On the batched mode, this is when the
+ * errors are checked, and attributed to the full chunk. On the debug
+ * mode, the errors were already reported, but the error flags are
+ * reset, so glGetError keeps working as expected.
+ */
+bool
+error_tracking_end_chunk_at(const char *file,
+                            int line)
+{
+   GLenum gl_err;
+   bool result = false;
+   uint64_t start;
+
+   if (current_mode == ERROR_MODE_SYNC || current_mode == ERROR_MODE_NONE)
+      return false;
+
+   start = timeline_begin();
+   gl_err = trace_gl.get_error();
+   while (gl_err != GL_NO_ERROR) {
+      result = true;
+      if (current_mode == ERROR_MODE_BATCHED) {
+         fprintf(stderr, "gl_error in cells %u-%u (%s, %s) "
+                 "in file %s @ line %d: %s\n",
+                 current_cell.first_cell, current_cell.cell,
+                 util_get_gl_enum_name(current_cell.pname),
+                 util_get_gl_enum_name(current_cell.target),
+                 file, line, gluErrorString(gl_err));
+      }
+
+      gl_err = trace_gl.get_error();
+   }
+
+   timeline_span(start, "gl", "error check", "target",
+                 util_get_gl_enum_name(current_cell.target));
+
+   return result;
+}
@@ -0,0 +1,69 @@
+/*
+ * Copyright © 2016 Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+#ifndef ERROR_TRACKING_H
+#define ERROR_TRACKING_H
+
+#include <GL/glew.h>
+#include <stdbool.h>
+
+/* How GL errors are detected and attributed to the query that caused
+ * them. */
+enum error_mode {
+   /* glGetError after each query */
+   ERROR_MODE_SYNC,
+   /* GL_KHR_debug callback, tagging each query with its cell, and
+    * glGetError only once per chunk, to reset the error flags */
+   ERROR_MODE_DEBUG,
+   /* glGetError only once per chunk, so errors can only be attributed
+    * to the chunk */
+   ERROR_MODE_BATCHED,
+   /* No error checks at all, for GL_KHR_no_error contexts */
+   ERROR_MODE_NONE,
+};
+
+bool error_mode_from_name(const char *name,
+                          enum error_mode *mode);
+
+void error_tracking_set_mode(enum error_mode mode);
+
+enum error_mode error_tracking_init_context(void);
+
+void error_tracking_begin_chunk(unsigned first_cell,
+                                GLenum pname,
+                                GLenum target);
+
+void error_tracking_set_cell(unsigned cell,
+                             GLenum internalformat,
+                             int testing64);
+
+#define error_tracking_check_cell() \
+   error_tracking_check_cell_at(__FILE__, __LINE__)
+bool error_tracking_check_cell_at(const char *file,
+                                  int line);
+
+#define error_tracking_end_chunk() \
+   error_tracking_end_chunk_at(__FILE__, __LINE__)
+bool error_tracking_end_chunk_at(const char *file,
+                                 int line);
+
+#endif /* ERROR_TRACKING_H */
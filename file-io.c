@@ -0,0 +1,235 @@
+/*
+ * Copyright © 2016 Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+/**
+ * Helpers shared by the files written and read by query2-info.
+ *
+ * All of them are written with an atomic_file, to a temporary file
+ * next to the destination, renamed over it only when everything was
+ * written, so a failed run never leaves a partial file.
+ *
+ * The binary formats (the results of --format bin, the database, the
+ * query log and the trace) start with a header that has the offset
+ * and size of each section, all of them FILE_SECTION_ALIGNMENT
+ * aligned, and are read mapping the whole file, checking each section
+ * against its size once.
+ */
+#define _GNU_SOURCE
+#include "file-io.h"
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+struct _atomic_file {
+   char *path;
+   char *tmp_path;
+   int fd;
+   output_buffer *out;
+};
+
+/*
+ * Creates the temporary file for @path, so an unwritable path fails
+ * before anything is done. Returns NULL if it can't be created.
+ */
+atomic_file*
+atomic_file_new(const char *path)
+{
+   atomic_file *file = (atomic_file*) calloc(1, sizeof(atomic_file));
+
+   if (asprintf(&file->tmp_path, "%s.%d.tmp", path, (int) getpid()) < 0) {
+      free(file);
+      return NULL;
+   }
+
+   file->fd = open(file->tmp_path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC,
+                   0644);
+   if (file->fd < 0) {
+      free(file->tmp_path);
+      free(file);
+      return NULL;
+   }
+
+   file->path = strdup(path);
+   file->out = output_buffer_new(file->fd);
+
+   return file;
+}
+
+/*
+ * Returns the buffer writing to the temporary file of @file.
+ */
+output_buffer*
+atomic_file_get_output(atomic_file *file)
+{
+   return file->out;
+}
+
+/*
+ * Writes the pending data of @file, replaces the destination with it,
+ * and frees @file. The temporary file is removed if there was any
+ * error, and false returned.
+ */
+bool
+atomic_file_finish(atomic_file **file)
+{
+   atomic_file *_file = *file;
+   bool success;
+
+   success = output_buffer_flush(_file->out);
+   output_buffer_clear(&_file->out);
+   success = close(_file->fd) == 0 && success;
+   if (success)
+      success = rename(_file->tmp_path, _file->path) == 0;
+   if (!success)
+      unlink(_file->tmp_path);
+
+   free(_file->tmp_path);
+   free(_file->path);
+   free(_file);
+   *file = NULL;
+
+   return success;
+}
+
+/*
+ * Maps the whole file at @path, read only, setting @size to its size.
+ * Returns NULL if it can't be read or it is empty.
+ */
+const void*
+file_map(const char *path,
+         size_t *size)
+{
+   struct stat st;
+   void *data;
+   int fd;
+
+   fd = open(path, O_RDONLY | O_CLOEXEC);
+   if (fd < 0)
+      return NULL;
+
+   if (fstat(fd, &st) < 0 || st.st_size == 0) {
+      close(fd);
+      return NULL;
+   }
+
+   data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+   close(fd);
+   if (data == MAP_FAILED)
+      return NULL;
+
+   *size = st.st_size;
+
+   return data;
+}
+
+void
+file_unmap(const void *data,
+           size_t size)
+{
+   munmap((void*) data, size);
+}
+
+/*
+ * Returns true if @section, of a file of @file_size bytes, is aligned,
+ * has @expected_size bytes, and all of them are on the file.
+ */
+bool
+file_section_is_valid(const file_section *section,
+                      size_t file_size,
+                      uint64_t expected_size)
+{
+   return section->size == expected_size &&
+      section->offset % FILE_SECTION_ALIGNMENT == 0 &&
+      section->offset <= file_size &&
+      section->size <= file_size - section->offset;
+}
+
+static size_t
+align_section(size_t offset)
+{
+   return (offset + FILE_SECTION_ALIGNMENT - 1) &
+      ~(size_t) (FILE_SECTION_ALIGNMENT - 1);
+}
+
+/*
+ * Sets the offsets of @sections, with their sizes already set, placing
+ * them in order, aligned, after a header of @header_size bytes.
+ */
+void
+file_sections_set_offsets(file_section *sections,
+                          unsigned num_sections,
+                          size_t header_size)
+{
+   size_t offset = header_size;
+   unsigned i;
+
+   for (i = 0; i < num_sections; i++) {
+      offset = align_section(offset);
+      sections[i].offset = offset;
+      offset += sections[i].size;
+   }
+}
+
+/*
+ * Appends to @out the padding needed to align @offset, the number of
+ * bytes written to it so far, and updates it.
+ */
+void
+file_section_append_padding(output_buffer *out,
+                            size_t *offset)
+{
+   static const char zeros[FILE_SECTION_ALIGNMENT];
+   size_t aligned = align_section(*offset);
+
+   output_buffer_append(out, zeros, aligned - *offset);
+   *offset = aligned;
+}
+
+/*
+ * Appends to @out the @header, that has the @sections, and the @data
+ * of each of them, laid out by file_sections_set_offsets.
+ */
+void
+file_sections_append(output_buffer *out,
+                     const void *header,
+                     size_t header_size,
+                     const file_section *sections,
+                     const void *const *data,
+                     unsigned num_sections)
+{
+   size_t offset = header_size;
+   unsigned i;
+
+   output_buffer_append(out, (const char*) header, header_size);
+   for (i = 0; i < num_sections; i++) {
+      file_section_append_padding(out, &offset);
+      if (sections[i].size > 0)
+         output_buffer_append(out, (const char*) data[i], sections[i].size);
+      offset += sections[i].size;
+   }
+}
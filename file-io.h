@@ -0,0 +1,84 @@
+/*
+ * Copyright © 2016 Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+#ifndef FILE_IO_H
+#define FILE_IO_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "output.h"
+
+/* Files written to a temporary one first, that only replaces the
+ * destination when all of it was written */
+typedef struct _atomic_file atomic_file;
+
+atomic_file* atomic_file_new(const char *path);
+
+output_buffer* atomic_file_get_output(atomic_file *file);
+
+bool atomic_file_finish(atomic_file **file);
+
+/* Alignment of each section of the binary formats */
+#define FILE_SECTION_ALIGNMENT 8
+
+/* Offset and size of a section, as stored on the headers of the binary
+ * formats */
+typedef struct _file_section {
+   uint64_t offset;
+   uint64_t size;
+} file_section;
+
+const void* file_map(const char *path,
+                     size_t *size);
+
+void file_unmap(const void *data,
+                size_t size);
+
+bool file_section_is_valid(const file_section *section,
+                           size_t file_size,
+                           uint64_t expected_size);
+
+/* Start of @section, on the file mapped at @data */
+static inline const void*
+file_section_data(const void *data,
+                  const file_section *section)
+{
+   return (const char*) data + section->offset;
+}
+
+void file_sections_set_offsets(file_section *sections,
+                               unsigned num_sections,
+                               size_t header_size);
+
+void file_section_append_padding(output_buffer *out,
+                                 size_t *offset);
+
+void file_sections_append(output_buffer *out,
+                          const void *header,
+                          size_t header_size,
+                          const file_section *sections,
+                          const void *const *data,
+                          unsigned num_sections);
+
+#endif /* FILE_IO_H */
@@ -0,0 +1,390 @@
+/*
+ * Copyright © 2016 Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+/**
+ * A driver is identified by three fingerprints:
+ *
+ *  - The GL one: GL_VENDOR, GL_RENDERER, GL_VERSION and a hash of the
+ *    extension list. It needs a current context.
+ *  - The system one: the PCI ids of the render nodes, and the
+ *    environment variables that change the driver being loaded.
+ *  - The libraries one: the path and the GNU build-id of each shared
+ *    library loaded by the process, including the driver.
+ *
+ * The last two can be checked without creating a context, reading the
+ * build-ids from the library files, so they are the ones used to know
+ * if stored results are still valid.
+ */
+#define _GNU_SOURCE
+#include "fingerprint.h"
+
+#include <elf.h>
+#include <fcntl.h>
+#include <glob.h>
+#include <link.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <GL/glew.h>
+
+/* 20 bytes (SHA-1) is the usual size, but allow bigger ones */
+#define MAX_BUILD_ID_SIZE 64
+
+static const char *driver_environment[] = {
+   "DRI_PRIME",
+   "GALLIUM_DRIVER",
+   "LIBGL_ALWAYS_SOFTWARE",
+   "MESA_EXTENSION_OVERRIDE",
+   "MESA_GL_VERSION_OVERRIDE",
+   "MESA_LOADER_DRIVER_OVERRIDE",
+   "__EGL_VENDOR_LIBRARY_FILENAMES",
+   "__GLX_VENDOR_LIBRARY_NAME",
+};
+
+static void
+append(char **str,
+       size_t *len,
+       const char *suffix)
+{
+   size_t suffix_len = strlen(suffix);
+
+   *str = (char*) realloc(*str, *len + suffix_len + 1);
+   memcpy(*str + *len, suffix, suffix_len + 1);
+   *len += suffix_len;
+}
+
+static uint64_t
+hash_string(uint64_t hash,
+            const char *str)
+{
+   /* FNV-1a */
+   for (; *str != '\0'; str++) {
+      hash ^= (unsigned char) *str;
+      hash *= 0x100000001b3ull;
+   }
+
+   return hash;
+}
+
+/*
+ * Returns the GL fingerprint of the current context, as
+ * "<vendor>\n<renderer>\n<version>\n<extensions hash>".
+ */
+char*
+fingerprint_gl(void)
+{
+   fingerprint_gl_functions functions;
+
+   functions.get_string = glGetString;
+   functions.get_stringi = glGetStringi;
+   functions.get_integerv = glGetIntegerv;
+
+   return fingerprint_gl_with(&functions);
+}
+
+/*
+ * Same as fingerprint_gl, but calling GL through @functions.
+ */
+char*
+fingerprint_gl_with(const fingerprint_gl_functions *functions)
+{
+   uint64_t hash = 0xcbf29ce484222325ull;
+   const char *vendor = (const char*) functions->get_string(GL_VENDOR);
+   const char *renderer = (const char*) functions->get_string(GL_RENDERER);
+   const char *version = (const char*) functions->get_string(GL_VERSION);
+   GLint num_extensions = 0;
+   GLint i;
+   char *result;
+
+   functions->get_integerv(GL_NUM_EXTENSIONS, &num_extensions);
+   for (i = 0; i < num_extensions; i++) {
+      hash = hash_string(hash, (const char*)
+                         functions->get_stringi(GL_EXTENSIONS, i));
+      hash = hash_string(hash, " ");
+   }
+
+   if (asprintf(&result, "%s\n%s\n%s\n%016llx",
+                vendor ? vendor : "", renderer ? renderer : "",
+                version ? version : "", (unsigned long long) hash) < 0)
+      return NULL;
+
+   return result;
+}
+
+static char*
+read_first_line(const char *path)
+{
+   char line[128];
+   FILE *file = fopen(path, "r");
+   char *result = NULL;
+
+   if (file == NULL)
+      return NULL;
+
+   if (fgets(line, sizeof(line), file) != NULL) {
+      line[strcspn(line, "\n")] = '\0';
+      result = strdup(line);
+   }
+   fclose(file);
+
+   return result;
+}
+
+/*
+ * Returns the system fingerprint, one "<name>=<value>" line for each
+ * render node and driver related environment variable.
+ */
+char*
+fingerprint_system(void)
+{
+   char *result = strdup("");
+   size_t len = 0;
+   glob_t nodes;
+   size_t i;
+
+   if (glob("/sys/class/drm/renderD*", 0, NULL, &nodes) == 0) {
+      for (i = 0; i < nodes.gl_pathc; i++) {
+         char path[512];
+         char *vendor;
+         char *device;
+
+         snprintf(path, sizeof(path), "%s/device/vendor", nodes.gl_pathv[i]);
+         vendor = read_first_line(path);
+         snprintf(path, sizeof(path), "%s/device/device", nodes.gl_pathv[i]);
+         device = read_first_line(path);
+
+         append(&result, &len, strrchr(nodes.gl_pathv[i], '/') + 1);
+         append(&result, &len, "=");
+         append(&result, &len, vendor ? vendor : "?");
+         append(&result, &len, ":");
+         append(&result, &len, device ? device : "?");
+         append(&result, &len, "\n");
+
+         free(vendor);
+         free(device);
+      }
+      globfree(&nodes);
+   }
+
+   for (i = 0;
+        i < sizeof(driver_environment) / sizeof(driver_environment[0]);
+        i++) {
+      const char *value = getenv(driver_environment[i]);
+
+      if (value == NULL)
+         continue;
+
+      append(&result, &len, driver_environment[i]);
+      append(&result, &len, "=");
+      append(&result, &len, value);
+      append(&result, &len, "\n");
+   }
+
+   return result;
+}
+
+/*
+ * Looks for a NT_GNU_BUILD_ID note on the @size bytes of notes at
+ * @notes, and writes it as an hex string on @hex. Returns false if not
+ * found.
+ */
+static bool
+find_build_id(const char *notes,
+              size_t size,
+              char hex[2 * MAX_BUILD_ID_SIZE + 1])
+{
+   size_t offset = 0;
+
+   while (offset + sizeof(ElfW(Nhdr)) <= size) {
+      const ElfW(Nhdr) *note = (const ElfW(Nhdr)*) (notes + offset);
+      size_t name_size = (note->n_namesz + 3) & ~3;
+      size_t desc_size = (note->n_descsz + 3) & ~3;
+      const unsigned char *desc = (const unsigned char*)
+         (notes + offset + sizeof(ElfW(Nhdr)) + name_size);
+
+      if (offset + sizeof(ElfW(Nhdr)) + name_size + desc_size > size)
+         return false;
+
+      if (note->n_type == NT_GNU_BUILD_ID && note->n_namesz == 4 &&
+          memcmp(notes + offset + sizeof(ElfW(Nhdr)), "GNU", 4) == 0 &&
+          note->n_descsz <= MAX_BUILD_ID_SIZE) {
+         unsigned i;
+
+         for (i = 0; i < note->n_descsz; i++)
+            sprintf(hex + 2 * i, "%02x", desc[i]);
+         hex[2 * note->n_descsz] = '\0';
+
+         return true;
+      }
+
+      offset += sizeof(ElfW(Nhdr)) + name_size + desc_size;
+   }
+
+   return false;
+}
+
+static int
+add_loaded_library(struct dl_phdr_info *info,
+                   size_t size,
+                   void *user_data)
+{
+   char **result = (char**) user_data;
+   char hex[2 * MAX_BUILD_ID_SIZE + 1];
+   char *path;
+   int i;
+
+   /* The main program */
+   if (info->dlpi_name == NULL || info->dlpi_name[0] == '\0')
+      return 0;
+
+   /* A relative LD_PRELOAD or dlopen() path is resolved from the current
+    * directory; the vdso has no file, so it fails and is skipped */
+   path = realpath(info->dlpi_name, NULL);
+   if (path == NULL)
+      return 0;
+
+   for (i = 0; i < info->dlpi_phnum; i++) {
+      const ElfW(Phdr) *phdr = &info->dlpi_phdr[i];
+
+      if (phdr->p_type != PT_NOTE)
+         continue;
+
+      if (find_build_id((const char*) (info->dlpi_addr + phdr->p_vaddr),
+                        phdr->p_memsz, hex)) {
+         size_t len = strlen(*result);
+
+         append(result, &len, path);
+         append(result, &len, " ");
+         append(result, &len, hex);
+         append(result, &len, "\n");
+         break;
+      }
+   }
+
+   free(path);
+   return 0;
+}
+
+/*
+ * Returns the libraries fingerprint, with a "<path> <build-id>" line
+ * for each shared library loaded with a build-id. To include the GL
+ * driver, it should be called after creating a context.
+ */
+char*
+fingerprint_libraries(void)
+{
+   char *result = strdup("");
+
+   dl_iterate_phdr(add_loaded_library, &result);
+
+   return result;
+}
+
+/* Reads the build-id of the library at @path, directly from the file */
+static bool
+read_build_id(const char *path,
+              char hex[2 * MAX_BUILD_ID_SIZE + 1])
+{
+   ElfW(Ehdr) header;
+   bool found = false;
+   int fd;
+   int i;
+
+   fd = open(path, O_RDONLY | O_CLOEXEC);
+   if (fd < 0)
+      return false;
+
+   if (pread(fd, &header, sizeof(header), 0) != sizeof(header) ||
+       memcmp(header.e_ident, ELFMAG, SELFMAG) != 0 ||
+       header.e_phentsize != sizeof(ElfW(Phdr))) {
+      close(fd);
+      return false;
+   }
+
+   for (i = 0; i < header.e_phnum && !found; i++) {
+      ElfW(Phdr) phdr;
+      char *notes;
+
+      if (pread(fd, &phdr, sizeof(phdr),
+                header.e_phoff + i * sizeof(phdr)) != sizeof(phdr))
+         break;
+
+      if (phdr.p_type != PT_NOTE || phdr.p_filesz > 65536)
+         continue;
+
+      notes = (char*) malloc(phdr.p_filesz);
+      if (pread(fd, notes, phdr.p_filesz, phdr.p_offset) ==
+          (ssize_t) phdr.p_filesz)
+         found = find_build_id(notes, phdr.p_filesz, hex);
+      free(notes);
+   }
+
+   close(fd);
+
+   return found;
+}
+
+/*
+ * Checks that each library listed on @libraries, as returned by
+ * fingerprint_libraries, still has the same build-id, without loading
+ * them.
+ */
+bool
+fingerprint_libraries_match(const char *libraries)
+{
+   const char *line = libraries;
+
+   while (*line != '\0') {
+      const char *end = strchr(line, '\n');
+      const char *separator;
+      char path[4096];
+      char hex[2 * MAX_BUILD_ID_SIZE + 1];
+      size_t path_len;
+
+      if (end == NULL)
+         return false;
+
+      /* The build-id has no spaces, but the path can */
+      separator = memrchr(line, ' ', end - line);
+      if (separator == NULL)
+         return false;
+
+      path_len = separator - line;
+      if (path_len >= sizeof(path))
+         return false;
+      memcpy(path, line, path_len);
+      path[path_len] = '\0';
+
+      if (!read_build_id(path, hex) ||
+          strlen(hex) != (size_t) (end - separator - 1) ||
+          memcmp(hex, separator + 1, end - separator - 1) != 0)
+         return false;
+
+      line = end + 1;
+   }
+
+   return true;
+}
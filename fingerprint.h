@@ -0,0 +1,51 @@
+/*
+ * Copyright © 2016 Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+#ifndef FINGERPRINT_H
+#define FINGERPRINT_H
+
+#include <GL/glew.h>
+#include <stdbool.h>
+
+/* Identification of the driver that answered the queries, so stored
+ * results can be matched with the driver being used. All the returned
+ * strings should be freed by the caller. */
+
+/* The GL entry points used for the GL fingerprint, for the callers
+ * that don't load them through GLEW */
+typedef struct _fingerprint_gl_functions {
+   const GLubyte* (GLAPIENTRY *get_string)(GLenum name);
+   const GLubyte* (GLAPIENTRY *get_stringi)(GLenum name, GLuint index);
+   void (GLAPIENTRY *get_integerv)(GLenum pname, GLint *data);
+} fingerprint_gl_functions;
+
+char* fingerprint_gl(void);
+
+char* fingerprint_gl_with(const fingerprint_gl_functions *functions);
+
+char* fingerprint_system(void);
+
+char* fingerprint_libraries(void);
+
+bool fingerprint_libraries_match(const char *libraries);
+
+#endif /* FINGERPRINT_H */
@@ -0,0 +1,106 @@
+#!/usr/bin/env python3
+#
+# Copyright © 2016 Intel Corporation
+#
+# Permission is hereby granted, free of charge, to any person obtaining a
+# copy of this software and associated documentation files (the "Software"),
+# to deal in the Software without restriction, including without limitation
+# the rights to use, copy, modify, merge, publish, distribute, sublicense,
+# and/or sell copies of the Software, and to permit persons to whom the
+# Software is furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice (including the next
+# paragraph) shall be included in all copies or substantial portions of the
+# Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+# THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+# IN THE SOFTWARE.
+
+"""Generates the tables used by util-string.c from gl-enums.txt.
+
+Usage: gen-enum-table.py <gl-enums.txt> <util-string-table.h>
+
+The output has the enum values sorted, the names stored on one string
+blob (each one NUL terminated), with the offset and length of each
+name, and, for the reverse lookup, the offsets and values of all the
+names, aliases included, sorted by name.
+"""
+
+import sys
+
+
+def parse(path):
+    """Returns the (value, name) pairs of the names printed, sorted by
+    value, and the ones of the aliases."""
+    enums = {}
+    aliases = []
+    names = set()
+    with open(path) as f:
+        for number, line in enumerate(f, 1):
+            line = line.split('#', 1)[0].strip()
+            if not line:
+                continue
+            value, name = line.split()
+            value = int(value, 0)
+            if name in names:
+                sys.exit('{}:{}: {} already listed'.format(path, number, name))
+            names.add(name)
+            if value in enums:
+                aliases.append((value, name))
+            else:
+                enums[value] = name
+    return sorted(enums.items()), aliases
+
+
+def write_array(out, ctype, name, values, per_line):
+    out.write('static const {} {}[] = {{\n'.format(ctype, name))
+    for i in range(0, len(values), per_line):
+        out.write('   ' + ' '.join('{},'.format(v)
+                                   for v in values[i:i + per_line]) + '\n')
+    out.write('};\n\n')
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit(__doc__.strip())
+
+    enums, aliases = parse(sys.argv[1])
+    offsets = []
+    blob = []
+    offset = 0
+    for _, name in enums + aliases:
+        offsets.append(offset)
+        blob.append(name)
+        offset += len(name) + 1
+
+    all_names = enums + aliases
+    by_name = sorted(range(len(all_names)), key=lambda i: all_names[i][1])
+
+    with open(sys.argv[2], 'w') as out:
+        out.write('/* Generated by gen-enum-table.py from {}. '
+                  'Do not edit. */\n\n'.format(sys.argv[1]))
+        out.write('#define ENUM_COUNT {}\n\n'.format(len(enums)))
+        write_array(out, 'uint32_t', 'enum_values',
+                    ['0x{:X}'.format(v) for v, _ in enums], 8)
+        write_array(out, 'uint32_t', 'enum_name_offsets',
+                    offsets[:len(enums)], 10)
+        write_array(out, 'uint8_t', 'enum_name_lengths',
+                    [len(n) for _, n in enums], 16)
+        out.write('#define NAME_COUNT {}\n\n'.format(len(all_names)))
+        write_array(out, 'uint32_t', 'name_offsets_by_name',
+                    [offsets[i] for i in by_name], 10)
+        write_array(out, 'uint32_t', 'name_values_by_name',
+                    ['0x{:X}'.format(all_names[i][0]) for i in by_name], 8)
+        out.write('static const char enum_names[] =\n')
+        for name in blob:
+            out.write('   "{}\\0"\n'.format(name))
+        out.write('   ;\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,570 @@
+/*
+ * Copyright © 2016 Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+/**
+ * Mock EGL/GL driver, answering the queries of query2-info from a
+ * database written by query2-info --database, to benchmark the tool
+ * itself without the noise of a real driver, on machines without a GPU
+ * or display:
+ *
+ *   Q2I_MOCK_DATABASE=results.db LD_PRELOAD=libq2i-mock.so \
+ *      query2-info --backend surfaceless
+ *
+ * It replaces the EGL entry points used by the surfaceless backend of
+ * context.c, and the GL ones used by the sweep, both the ones exported
+ * by libGL and the pointers returned by glXGetProcAddress(ARB) and
+ * eglGetProcAddress, so GLEW loads them. Each context can only be used
+ * by one thread at a time, as with a real driver, so --jobs works.
+ *
+ * Q2I_MOCK_LATENCY_NS adds that latency, spinning on the clock, to
+ * each glGetInternalformat*v call, to stand in for the cost of the
+ * driver.
+ *
+ * The 32-bit queries are answered with the 32-bit results of the
+ * database, if it was written with -b, or else with the 64-bit ones
+ * clamped, that the real driver may not do. The cells not on it (like
+ * the unsupported ones of a database written with -f) are left
+ * untouched, without error.
+ */
+#define _GNU_SOURCE
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+
+#include "database.h"
+
+/* GLEW turns the GL entry points into macros */
+#undef glGetInternalformativ
+#undef glGetInternalformati64v
+#undef glGetStringi
+#undef glDebugMessageCallback
+#undef glDebugMessageControl
+
+typedef void (*glx_proc)(void);
+
+/* Not including GL/glx.h, to not depend on Xlib */
+glx_proc glXGetProcAddress(const GLubyte *name);
+glx_proc glXGetProcAddressARB(const GLubyte *name);
+
+#define MOCK_VERSION_MAJOR 4
+#define MOCK_VERSION_MINOR 6
+
+static const char *mock_extensions[] = {
+   "GL_ARB_internalformat_query",
+   "GL_ARB_internalformat_query2",
+   "GL_KHR_debug",
+};
+
+#define NUM_MOCK_EXTENSIONS \
+   (sizeof(mock_extensions) / sizeof(mock_extensions[0]))
+
+typedef struct _mock_context {
+   /* Set with EGL_CONTEXT_OPENGL_NO_ERROR_KHR */
+   bool no_error;
+   GLenum error;
+   bool debug_output;
+   GLDEBUGPROC debug_callback;
+   const void *debug_user_param;
+} mock_context;
+
+static struct {
+   result_db *db;
+   uint64_t latency_ns;
+   /* GL_EXTENSIONS, as returned by glGetString */
+   char *extensions;
+} mock;
+
+/* The display is a token, all of them being the same one */
+static int mock_display;
+
+static pthread_once_t init_once = PTHREAD_ONCE_INIT;
+
+static __thread mock_context *current_context = NULL;
+
+static void
+init(void)
+{
+   const char *path = getenv("Q2I_MOCK_DATABASE");
+   const char *latency = getenv("Q2I_MOCK_LATENCY_NS");
+   size_t size = 1;
+   unsigned i;
+
+   if (latency != NULL)
+      mock.latency_ns = strtoull(latency, NULL, 10);
+
+   for (i = 0; i < NUM_MOCK_EXTENSIONS; i++)
+      size += strlen(mock_extensions[i]) + 1;
+   mock.extensions = (char*) calloc(1, size);
+   for (i = 0; i < NUM_MOCK_EXTENSIONS; i++) {
+      if (i > 0)
+         strcat(mock.extensions, " ");
+      strcat(mock.extensions, mock_extensions[i]);
+   }
+
+   if (path == NULL) {
+      fprintf(stderr, "query2-info mock: Q2I_MOCK_DATABASE is not set\n");
+      return;
+   }
+
+   mock.db = result_db_open(path);
+   if (mock.db == NULL)
+      fprintf(stderr, "query2-info mock: can't open %s\n", path);
+}
+
+static void
+wait_latency(void)
+{
+   struct timespec ts;
+   uint64_t now;
+   uint64_t end;
+
+   if (mock.latency_ns == 0)
+      return;
+
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   now = (uint64_t) ts.tv_sec * 1000000000ull + ts.tv_nsec;
+   end = now + mock.latency_ns;
+   /* Spinning, as sleeping has a much coarser resolution than the
+    * latency of a query */
+   while (now < end) {
+      clock_gettime(CLOCK_MONOTONIC, &ts);
+      now = (uint64_t) ts.tv_sec * 1000000000ull + ts.tv_nsec;
+   }
+}
+
+/* Sets @error on the current context, if it has none, and sends it to
+ * the debug callback, if enabled */
+static void
+raise_error(GLenum error,
+            const char *message)
+{
+   mock_context *ctx = current_context;
+
+   if (ctx == NULL || ctx->no_error)
+      return;
+
+   if (ctx->error == GL_NO_ERROR)
+      ctx->error = error;
+
+   if (ctx->debug_output && ctx->debug_callback != NULL)
+      ctx->debug_callback(GL_DEBUG_SOURCE_API, GL_DEBUG_TYPE_ERROR, error,
+                          GL_DEBUG_SEVERITY_HIGH, strlen(message), message,
+                          ctx->debug_user_param);
+}
+
+/* Returns the cell to answer the query with, or NULL if there is none,
+ * raising the error of the query, if any */
+static const result_db_cell*
+lookup(bool testing64,
+       GLenum target,
+       GLenum internalformat,
+       GLenum pname,
+       GLsizei count,
+       const void *params)
+{
+   if (current_context == NULL || mock.db == NULL)
+      return NULL;
+
+   wait_latency();
+
+   if (count < 0) {
+      raise_error(GL_INVALID_VALUE, "glGetInternalformat*v(bufSize < 0)");
+      return NULL;
+   }
+   if (count == 0 || params == NULL)
+      return NULL;
+
+   return result_db_lookup(mock.db, testing64, pname, target,
+                           internalformat);
+}
+
+void GLAPIENTRY
+glGetInternalformati64v(GLenum target,
+                        GLenum internalformat,
+                        GLenum pname,
+                        GLsizei count,
+                        GLint64 *params)
+{
+   const result_db_cell *cell = lookup(true, target, internalformat, pname,
+                                       count, params);
+   unsigned num_values;
+
+   if (cell == NULL)
+      return;
+
+   num_values = cell->num_values < (unsigned) count ?
+      cell->num_values : (unsigned) count;
+
+   memcpy(params, result_db_get_values(mock.db, cell),
+          num_values * sizeof(GLint64));
+}
+
+void GLAPIENTRY
+glGetInternalformativ(GLenum target,
+                      GLenum internalformat,
+                      GLenum pname,
+                      GLsizei count,
+                      GLint *params)
+{
+   const result_db_cell *cell = lookup(false, target, internalformat, pname,
+                                       count, params);
+   const int64_t *values;
+   unsigned num_values;
+   unsigned i;
+
+   if (cell == NULL)
+      return;
+
+   num_values = cell->num_values < (unsigned) count ?
+      cell->num_values : (unsigned) count;
+
+   values = result_db_get_values(mock.db, cell);
+   for (i = 0; i < num_values; i++) {
+      if (values[i] > INT32_MAX)
+         params[i] = INT32_MAX;
+      else if (values[i] < INT32_MIN)
+         params[i] = INT32_MIN;
+      else
+         params[i] = values[i];
+   }
+}
+
+GLenum GLAPIENTRY
+glGetError(void)
+{
+   mock_context *ctx = current_context;
+   GLenum error;
+
+   if (ctx == NULL)
+      return GL_NO_ERROR;
+
+   error = ctx->error;
+   ctx->error = GL_NO_ERROR;
+
+   return error;
+}
+
+const GLubyte* GLAPIENTRY
+glGetString(GLenum name)
+{
+   pthread_once(&init_once, init);
+
+   switch (name) {
+   case GL_VENDOR:
+      return (const GLubyte*) "query2-info";
+   case GL_RENDERER:
+      return (const GLubyte*) "query2-info mock driver";
+   case GL_VERSION:
+      return (const GLubyte*) "4.6 (Core Profile) query2-info mock";
+   case GL_SHADING_LANGUAGE_VERSION:
+      return (const GLubyte*) "4.60";
+   case GL_EXTENSIONS:
+      return (const GLubyte*) mock.extensions;
+   default:
+      raise_error(GL_INVALID_ENUM, "glGetString(name)");
+      return NULL;
+   }
+}
+
+const GLubyte* GLAPIENTRY
+glGetStringi(GLenum name,
+             GLuint index)
+{
+   if (name != GL_EXTENSIONS || index >= NUM_MOCK_EXTENSIONS) {
+      raise_error(name != GL_EXTENSIONS ? GL_INVALID_ENUM : GL_INVALID_VALUE,
+                  "glGetStringi(name, index)");
+      return NULL;
+   }
+
+   return (const GLubyte*) mock_extensions[index];
+}
+
+void GLAPIENTRY
+glGetIntegerv(GLenum pname,
+              GLint *data)
+{
+   switch (pname) {
+   case GL_NUM_EXTENSIONS:
+      *data = NUM_MOCK_EXTENSIONS;
+      break;
+   case GL_MAJOR_VERSION:
+      *data = MOCK_VERSION_MAJOR;
+      break;
+   case GL_MINOR_VERSION:
+      *data = MOCK_VERSION_MINOR;
+      break;
+   case GL_CONTEXT_PROFILE_MASK:
+      *data = GL_CONTEXT_CORE_PROFILE_BIT;
+      break;
+   case GL_CONTEXT_FLAGS:
+      *data = current_context != NULL && current_context->no_error ?
+         GL_CONTEXT_FLAG_NO_ERROR_BIT_KHR : 0;
+      break;
+   default:
+      raise_error(GL_INVALID_ENUM, "glGetIntegerv(pname)");
+      break;
+   }
+}
+
+void GLAPIENTRY
+glEnable(GLenum cap)
+{
+   if (current_context == NULL)
+      return;
+
+   if (cap == GL_DEBUG_OUTPUT)
+      current_context->debug_output = true;
+   else if (cap != GL_DEBUG_OUTPUT_SYNCHRONOUS)
+      raise_error(GL_INVALID_ENUM, "glEnable(cap)");
+}
+
+/* All the messages are errors, so the filters are ignored */
+void GLAPIENTRY
+glDebugMessageControl(GLenum source,
+                      GLenum type,
+                      GLenum severity,
+                      GLsizei count,
+                      const GLuint *ids,
+                      GLboolean enabled)
+{
+}
+
+void GLAPIENTRY
+glDebugMessageCallback(GLDEBUGPROC callback,
+                       const void *user_param)
+{
+   if (current_context == NULL)
+      return;
+
+   current_context->debug_callback = callback;
+   current_context->debug_user_param = user_param;
+}
+
+EGLDisplay EGLAPIENTRY
+eglGetDisplay(EGLNativeDisplayType display_id)
+{
+   return (EGLDisplay) &mock_display;
+}
+
+EGLDisplay EGLAPIENTRY
+eglGetPlatformDisplay(EGLenum platform,
+                      void *native_display,
+                      const EGLAttrib *attrib_list)
+{
+   if (platform != EGL_PLATFORM_SURFACELESS_MESA)
+      return EGL_NO_DISPLAY;
+
+   return (EGLDisplay) &mock_display;
+}
+
+static EGLDisplay EGLAPIENTRY
+get_platform_display_ext(EGLenum platform,
+                         void *native_display,
+                         const EGLint *attrib_list)
+{
+   return eglGetPlatformDisplay(platform, native_display, NULL);
+}
+
+/* Fails if there is no database to answer the queries, so
+ * query2-info doesn't fall back to another backend */
+EGLBoolean EGLAPIENTRY
+eglInitialize(EGLDisplay dpy,
+              EGLint *major,
+              EGLint *minor)
+{
+   pthread_once(&init_once, init);
+   if (dpy != (EGLDisplay) &mock_display || mock.db == NULL)
+      return EGL_FALSE;
+
+   if (major != NULL)
+      *major = 1;
+   if (minor != NULL)
+      *minor = 5;
+
+   return EGL_TRUE;
+}
+
+EGLBoolean EGLAPIENTRY
+eglTerminate(EGLDisplay dpy)
+{
+   return EGL_TRUE;
+}
+
+const char* EGLAPIENTRY
+eglQueryString(EGLDisplay dpy,
+               EGLint name)
+{
+   switch (name) {
+   case EGL_EXTENSIONS:
+      if (dpy == EGL_NO_DISPLAY)
+         return "EGL_EXT_client_extensions EGL_EXT_platform_base "
+            "EGL_MESA_platform_surfaceless";
+      return "EGL_KHR_create_context EGL_KHR_create_context_no_error "
+         "EGL_KHR_no_config_context EGL_KHR_surfaceless_context";
+   case EGL_VENDOR:
+      return "query2-info";
+   case EGL_VERSION:
+      return "1.5 query2-info mock";
+   case EGL_CLIENT_APIS:
+      return "OpenGL";
+   default:
+      return NULL;
+   }
+}
+
+EGLBoolean EGLAPIENTRY
+eglChooseConfig(EGLDisplay dpy,
+                const EGLint *attrib_list,
+                EGLConfig *configs,
+                EGLint config_size,
+                EGLint *num_config)
+{
+   *num_config = 0;
+
+   return EGL_TRUE;
+}
+
+EGLBoolean EGLAPIENTRY
+eglBindAPI(EGLenum api)
+{
+   return api == EGL_OPENGL_API;
+}
+
+EGLContext EGLAPIENTRY
+eglCreateContext(EGLDisplay dpy,
+                 EGLConfig config,
+                 EGLContext share_context,
+                 const EGLint *attrib_list)
+{
+   mock_context *ctx;
+   unsigned i;
+
+   if (dpy != (EGLDisplay) &mock_display)
+      return EGL_NO_CONTEXT;
+
+   ctx = (mock_context*) calloc(1, sizeof(mock_context));
+   for (i = 0; attrib_list != NULL && attrib_list[i] != EGL_NONE; i += 2) {
+      if (attrib_list[i] == EGL_CONTEXT_OPENGL_NO_ERROR_KHR)
+         ctx->no_error = attrib_list[i + 1] == EGL_TRUE;
+   }
+
+   return (EGLContext) ctx;
+}
+
+EGLBoolean EGLAPIENTRY
+eglDestroyContext(EGLDisplay dpy,
+                  EGLContext ctx)
+{
+   if (current_context == (mock_context*) ctx)
+      current_context = NULL;
+   free(ctx);
+
+   return EGL_TRUE;
+}
+
+EGLBoolean EGLAPIENTRY
+eglMakeCurrent(EGLDisplay dpy,
+               EGLSurface draw,
+               EGLSurface read,
+               EGLContext ctx)
+{
+   current_context = (mock_context*) ctx;
+
+   return EGL_TRUE;
+}
+
+EGLContext EGLAPIENTRY
+eglGetCurrentContext(void)
+{
+   return current_context != NULL ?
+      (EGLContext) current_context : EGL_NO_CONTEXT;
+}
+
+EGLBoolean EGLAPIENTRY
+eglReleaseThread(void)
+{
+   current_context = NULL;
+
+   return EGL_TRUE;
+}
+
+EGLint EGLAPIENTRY
+eglGetError(void)
+{
+   return EGL_SUCCESS;
+}
+
+static const struct {
+   const char *name;
+   void *proc;
+} mock_procs[] = {
+   { "glGetInternalformativ", (void*) glGetInternalformativ },
+   { "glGetInternalformati64v", (void*) glGetInternalformati64v },
+   { "glGetError", (void*) glGetError },
+   { "glGetString", (void*) glGetString },
+   { "glGetStringi", (void*) glGetStringi },
+   { "glGetIntegerv", (void*) glGetIntegerv },
+   { "glEnable", (void*) glEnable },
+   { "glDebugMessageControl", (void*) glDebugMessageControl },
+   { "glDebugMessageCallback", (void*) glDebugMessageCallback },
+   { "eglGetPlatformDisplay", (void*) eglGetPlatformDisplay },
+   { "eglGetPlatformDisplayEXT", (void*) get_platform_display_ext },
+};
+
+/* Returns the entry point @name, or NULL if the mock doesn't have it */
+static void*
+get_proc(const char *name)
+{
+   unsigned i;
+
+   for (i = 0; i < sizeof(mock_procs) / sizeof(mock_procs[0]); i++) {
+      if (strcmp(name, mock_procs[i].name) == 0)
+         return mock_procs[i].proc;
+   }
+
+   return NULL;
+}
+
+glx_proc
+glXGetProcAddress(const GLubyte *name)
+{
+   return (glx_proc) get_proc((const char*) name);
+}
+
+glx_proc
+glXGetProcAddressARB(const GLubyte *name)
+{
+   return (glx_proc) get_proc((const char*) name);
+}
+
+__eglMustCastToProperFunctionPointerType EGLAPIENTRY
+eglGetProcAddress(const char *procname)
+{
+   return (__eglMustCastToProperFunctionPointerType) get_proc(procname);
+}
@@ -0,0 +1,272 @@
+/*
+ * Copyright © 2016 Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+#include "output.h"
+
+#include <errno.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "timeline.h"
+
+/* Size of the buffer of file backed outputs, and initial size of the
+ * memory only ones */
+#define FD_BUFFER_SIZE (1 << 20)
+#define MEMORY_BUFFER_SIZE (1 << 12)
+
+struct _output_buffer {
+   /* -1 for memory only buffers */
+   int fd;
+   char *data;
+   size_t size;
+   size_t capacity;
+   /* Set when a write fails, including the ones done when the buffer
+    * gets full, so output_buffer_flush reports them */
+   bool failed;
+};
+
+static output_buffer *stdout_buffer = NULL;
+static output_buffer *stderr_buffer = NULL;
+
+static const int fatal_signals[] = {
+   SIGHUP, SIGINT, SIGQUIT, SIGTERM, SIGABRT, SIGSEGV, SIGBUS,
+};
+
+/* Writes all the pending data of @out. Only uses async-signal-safe
+ * functions, as it is also called from the fatal signal handler. */
+static bool
+write_all(output_buffer *out)
+{
+   size_t written = 0;
+
+   while (written < out->size) {
+      ssize_t result = write(out->fd, out->data + written,
+                             out->size - written);
+      if (result < 0) {
+         if (errno == EINTR)
+            continue;
+         out->size = 0;
+         out->failed = true;
+         return false;
+      }
+      written += result;
+   }
+   out->size = 0;
+
+   return true;
+}
+
+output_buffer*
+output_buffer_new(int fd)
+{
+   output_buffer *result;
+
+   result = (output_buffer*) malloc(sizeof(output_buffer));
+   result->fd = fd;
+   result->size = 0;
+   result->capacity = fd >= 0 ? FD_BUFFER_SIZE : MEMORY_BUFFER_SIZE;
+   result->data = (char*) malloc(result->capacity);
+   result->failed = false;
+
+   return result;
+}
+
+/*
+ * Flushes @out if it is backed by a file descriptor, frees it, and sets
+ * its value to NULL.
+ */
+void
+output_buffer_clear(output_buffer **out)
+{
+   output_buffer *_out = *out;
+
+   if (_out == NULL)
+      return;
+
+   output_buffer_flush(_out);
+   if (_out == stdout_buffer)
+      stdout_buffer = NULL;
+   if (_out == stderr_buffer)
+      stderr_buffer = NULL;
+
+   free(_out->data);
+   free(_out);
+   *out = NULL;
+}
+
+/* Makes room for at least @len more bytes */
+static void
+reserve(output_buffer *out,
+        size_t len)
+{
+   if (out->size + len <= out->capacity)
+      return;
+
+   if (out->fd >= 0) {
+      output_buffer_flush(out);
+      if (len <= out->capacity)
+         return;
+   }
+
+   while (out->size + len > out->capacity)
+      out->capacity *= 2;
+   out->data = (char*) realloc(out->data, out->capacity);
+}
+
+void
+output_buffer_append(output_buffer *out,
+                     const char *str,
+                     size_t len)
+{
+   reserve(out, len);
+   memcpy(out->data + out->size, str, len);
+   out->size += len;
+}
+
+void
+output_buffer_append_str(output_buffer *out,
+                         const char *str)
+{
+   output_buffer_append(out, str, strlen(str));
+}
+
+void
+output_buffer_append_char(output_buffer *out,
+                          char c)
+{
+   reserve(out, 1);
+   out->data[out->size++] = c;
+}
+
+void
+output_buffer_append_int64(output_buffer *out,
+                           int64_t value)
+{
+   /* Enough for the 19 digits of INT64_MIN plus the sign */
+   char digits[20];
+   char *end = digits + sizeof(digits);
+   char *start = end;
+   /* Computed as unsigned, to not overflow with INT64_MIN */
+   uint64_t abs_value = value < 0 ? -(uint64_t) value : (uint64_t) value;
+
+   do {
+      *--start = '0' + abs_value % 10;
+      abs_value /= 10;
+   } while (abs_value != 0);
+
+   if (value < 0)
+      *--start = '-';
+
+   output_buffer_append(out, start, end - start);
+}
+
+void
+output_buffer_append_buffer(output_buffer *out,
+                            const output_buffer *src)
+{
+   output_buffer_append(out, src->data, src->size);
+}
+
+/*
+ * Writes the pending content of @out to its file descriptor. Returns
+ * false if there was an error writing it, or any previous content of
+ * @out. Memory only buffers are not modified.
+ */
+bool
+output_buffer_flush(output_buffer *out)
+{
+   size_t size = out->size;
+   uint64_t start;
+
+   if (out->fd < 0 || size == 0)
+      return !out->failed;
+
+   start = timeline_begin();
+   write_all(out);
+   timeline_span_int(start, "output", "flush", "bytes", size);
+
+   return !out->failed;
+}
+
+static void
+flush_stdout_at_exit(void)
+{
+   if (stdout_buffer != NULL)
+      output_buffer_flush(stdout_buffer);
+}
+
+static void
+flush_stdout_on_signal(int sig)
+{
+   if (stdout_buffer != NULL)
+      write_all(stdout_buffer);
+
+   /* The handler was installed with SA_RESETHAND, so this will use the
+    * default action */
+   raise(sig);
+}
+
+/*
+ * Returns the buffer used to write on stdout. It is created on the
+ * first call, and flushed on exit, and on any fatal signal.
+ */
+output_buffer*
+output_stdout(void)
+{
+   struct sigaction action;
+   unsigned i;
+
+   if (stdout_buffer != NULL)
+      return stdout_buffer;
+
+   fflush(stdout);
+   stdout_buffer = output_buffer_new(STDOUT_FILENO);
+
+   atexit(flush_stdout_at_exit);
+
+   memset(&action, 0, sizeof(action));
+   action.sa_handler = flush_stdout_on_signal;
+   action.sa_flags = SA_RESETHAND;
+   sigemptyset(&action.sa_mask);
+   for (i = 0; i < sizeof(fatal_signals) / sizeof(fatal_signals[0]); i++)
+      sigaction(fatal_signals[i], &action, NULL);
+
+   return stdout_buffer;
+}
+
+/*
+ * Returns the buffer used to write on stderr, created on the first
+ * call. As stderr is unbuffered, callers flush it after each message.
+ */
+output_buffer*
+output_stderr(void)
+{
+   if (stderr_buffer == NULL) {
+      fflush(stderr);
+      stderr_buffer = output_buffer_new(STDERR_FILENO);
+   }
+
+   return stderr_buffer;
+}
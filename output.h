@@ -0,0 +1,62 @@
+/*
+ * Copyright © 2016 Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+#ifndef OUTPUT_H
+#define OUTPUT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Buffered writer used for the output of the queries, avoiding the
+ * format parsing and locking of stdio. A buffer can be backed by a
+ * file descriptor, being written with write(2) each time it gets full,
+ * or be a memory only one, that just grows as needed. */
+typedef struct _output_buffer output_buffer;
+
+output_buffer* output_buffer_new(int fd);
+
+void output_buffer_clear(output_buffer **out);
+
+void output_buffer_append(output_buffer *out,
+                          const char *str,
+                          size_t len);
+
+void output_buffer_append_str(output_buffer *out,
+                              const char *str);
+
+void output_buffer_append_char(output_buffer *out,
+                               char c);
+
+void output_buffer_append_int64(output_buffer *out,
+                                int64_t value);
+
+void output_buffer_append_buffer(output_buffer *out,
+                                 const output_buffer *src);
+
+bool output_buffer_flush(output_buffer *out);
+
+output_buffer* output_stdout(void);
+
+output_buffer* output_stderr(void);
+
+#endif /* OUTPUT_H */
@@ -0,0 +1,114 @@
+/*
+ * Copyright © 2016 Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+#ifndef PNAME_TABLE_H
+#define PNAME_TABLE_H
+
+/* The pnames queried, on the order used for the output, with what is
+ * known of each of them:
+ *
+ *  - The kind of value returned: a plain integer, a GL boolean, or a
+ *    GL enum, that can also be GL_NONE.
+ *  - How many values are returned: one, or as many as
+ *    GL_NUM_SAMPLE_COUNTS returns (for GL_SAMPLES).
+ *
+ * To be expanded with an X(pname, kind, count) macro, with the kind and
+ * count being the suffixes of the pname_value_kind and
+ * pname_value_count enums.
+ */
+#define PNAME_TABLE(X) \
+   X(GL_SAMPLES,                                INTEGER, SAMPLE_COUNTS) \
+   X(GL_NUM_SAMPLE_COUNTS,                      INTEGER, ONE) \
+   X(GL_INTERNALFORMAT_SUPPORTED,               BOOLEAN, ONE) \
+   X(GL_INTERNALFORMAT_PREFERRED,               ENUM,    ONE) \
+   X(GL_INTERNALFORMAT_RED_SIZE,                INTEGER, ONE) \
+   X(GL_INTERNALFORMAT_GREEN_SIZE,              INTEGER, ONE) \
+   X(GL_INTERNALFORMAT_BLUE_SIZE,               INTEGER, ONE) \
+   X(GL_INTERNALFORMAT_ALPHA_SIZE,              INTEGER, ONE) \
+   X(GL_INTERNALFORMAT_DEPTH_SIZE,              INTEGER, ONE) \
+   X(GL_INTERNALFORMAT_STENCIL_SIZE,            INTEGER, ONE) \
+   X(GL_INTERNALFORMAT_SHARED_SIZE,             INTEGER, ONE) \
+   X(GL_INTERNALFORMAT_RED_TYPE,                ENUM,    ONE) \
+   X(GL_INTERNALFORMAT_GREEN_TYPE,              ENUM,    ONE) \
+   X(GL_INTERNALFORMAT_BLUE_TYPE,               ENUM,    ONE) \
+   X(GL_INTERNALFORMAT_ALPHA_TYPE,              ENUM,    ONE) \
+   X(GL_INTERNALFORMAT_DEPTH_TYPE,              ENUM,    ONE) \
+   X(GL_INTERNALFORMAT_STENCIL_TYPE,            ENUM,    ONE) \
+   X(GL_MAX_WIDTH,                              INTEGER, ONE) \
+   X(GL_MAX_HEIGHT,                             INTEGER, ONE) \
+   X(GL_MAX_DEPTH,                              INTEGER, ONE) \
+   X(GL_MAX_LAYERS,                             INTEGER, ONE) \
+   X(GL_MAX_COMBINED_DIMENSIONS,                INTEGER, ONE) \
+   X(GL_COLOR_COMPONENTS,                       BOOLEAN, ONE) \
+   X(GL_DEPTH_COMPONENTS,                       BOOLEAN, ONE) \
+   X(GL_STENCIL_COMPONENTS,                     BOOLEAN, ONE) \
+   X(GL_COLOR_RENDERABLE,                       BOOLEAN, ONE) \
+   X(GL_DEPTH_RENDERABLE,                       BOOLEAN, ONE) \
+   X(GL_STENCIL_RENDERABLE,                     BOOLEAN, ONE) \
+   X(GL_FRAMEBUFFER_RENDERABLE,                 ENUM,    ONE) \
+   X(GL_FRAMEBUFFER_RENDERABLE_LAYERED,         ENUM,    ONE) \
+   X(GL_FRAMEBUFFER_BLEND,                      ENUM,    ONE) \
+   X(GL_READ_PIXELS,                            ENUM,    ONE) \
+   X(GL_READ_PIXELS_FORMAT,                     ENUM,    ONE) \
+   X(GL_READ_PIXELS_TYPE,                       ENUM,    ONE) \
+   X(GL_TEXTURE_IMAGE_FORMAT,                   ENUM,    ONE) \
+   X(GL_TEXTURE_IMAGE_TYPE,                     ENUM,    ONE) \
+   X(GL_GET_TEXTURE_IMAGE_FORMAT,               ENUM,    ONE) \
+   X(GL_GET_TEXTURE_IMAGE_TYPE,                 ENUM,    ONE) \
+   X(GL_MIPMAP,                                 BOOLEAN, ONE) \
+   X(GL_MANUAL_GENERATE_MIPMAP,                 ENUM,    ONE) \
+   X(GL_AUTO_GENERATE_MIPMAP,                   ENUM,    ONE) \
+   X(GL_COLOR_ENCODING,                         ENUM,    ONE) \
+   X(GL_SRGB_READ,                              ENUM,    ONE) \
+   X(GL_SRGB_WRITE,                             ENUM,    ONE) \
+   X(GL_SRGB_DECODE_ARB,                        ENUM,    ONE) \
+   X(GL_FILTER,                                 ENUM,    ONE) \
+   X(GL_VERTEX_TEXTURE,                         ENUM,    ONE) \
+   X(GL_TESS_CONTROL_TEXTURE,                   ENUM,    ONE) \
+   X(GL_TESS_EVALUATION_TEXTURE,                ENUM,    ONE) \
+   X(GL_GEOMETRY_TEXTURE,                       ENUM,    ONE) \
+   X(GL_FRAGMENT_TEXTURE,                       ENUM,    ONE) \
+   X(GL_COMPUTE_TEXTURE,                        ENUM,    ONE) \
+   X(GL_TEXTURE_SHADOW,                         ENUM,    ONE) \
+   X(GL_TEXTURE_GATHER,                         ENUM,    ONE) \
+   X(GL_TEXTURE_GATHER_SHADOW,                  ENUM,    ONE) \
+   X(GL_SHADER_IMAGE_LOAD,                      ENUM,    ONE) \
+   X(GL_SHADER_IMAGE_STORE,                     ENUM,    ONE) \
+   X(GL_SHADER_IMAGE_ATOMIC,                    ENUM,    ONE) \
+   X(GL_IMAGE_TEXEL_SIZE,                       INTEGER, ONE) \
+   X(GL_IMAGE_COMPATIBILITY_CLASS,              ENUM,    ONE) \
+   X(GL_IMAGE_PIXEL_FORMAT,                     ENUM,    ONE) \
+   X(GL_IMAGE_PIXEL_TYPE,                       ENUM,    ONE) \
+   X(GL_IMAGE_FORMAT_COMPATIBILITY_TYPE,        ENUM,    ONE) \
+   X(GL_SIMULTANEOUS_TEXTURE_AND_DEPTH_TEST,    ENUM,    ONE) \
+   X(GL_SIMULTANEOUS_TEXTURE_AND_STENCIL_TEST,  ENUM,    ONE) \
+   X(GL_SIMULTANEOUS_TEXTURE_AND_DEPTH_WRITE,   ENUM,    ONE) \
+   X(GL_SIMULTANEOUS_TEXTURE_AND_STENCIL_WRITE, ENUM,    ONE) \
+   X(GL_TEXTURE_COMPRESSED,                     BOOLEAN, ONE) \
+   X(GL_TEXTURE_COMPRESSED_BLOCK_WIDTH,         INTEGER, ONE) \
+   X(GL_TEXTURE_COMPRESSED_BLOCK_HEIGHT,        INTEGER, ONE) \
+   X(GL_TEXTURE_COMPRESSED_BLOCK_SIZE,          INTEGER, ONE) \
+   X(GL_CLEAR_BUFFER,                           ENUM,    ONE) \
+   X(GL_TEXTURE_VIEW,                           ENUM,    ONE) \
+   X(GL_VIEW_COMPATIBILITY_CLASS,               ENUM,    ONE)
+
+#endif /* PNAME_TABLE_H */
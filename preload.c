@@ -0,0 +1,480 @@
+/*
+ * Copyright © 2016 Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+/**
+ * LD_PRELOAD library that answers glGetInternalformativ and
+ * glGetInternalformati64v from a database written by query2-info
+ * --database, instead of calling the driver:
+ *
+ *   Q2I_DATABASE=results.db LD_PRELOAD=libq2i-preload.so <application>
+ *
+ * Both the functions exported by libGL and the pointers returned by
+ * glXGetProcAddress(ARB) and eglGetProcAddress are replaced. The
+ * database is only used if its GL fingerprint matches the one of the
+ * first context the application queries with, so the process is
+ * expected to use a single driver.
+ *
+ * The queries not on the database go to the driver, so it returns the
+ * values and raises the errors itself. Those are the ones with invalid
+ * arguments, the ones the driver didn't write when the database was
+ * captured, as they raised an error or have no values (see
+ * database.c), and the 32-bit ones of a value that doesn't fit when
+ * the database has only the 64-bit results (written without -b). The
+ * number of hits and misses is printed on stderr at exit.
+ *
+ * With Q2I_RECORD, those calls, and the ones to glGetIntegerv,
+ * glGetInteger64v and glGetBooleanv, are also recorded on the query
+ * log at that path (see recorder.c), written at exit, that
+ * query2-info --plan can use to query only what the application
+ * needs. Both variables can be used at the same time.
+ */
+#define _GNU_SOURCE
+#include <dlfcn.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <EGL/egl.h>
+
+#include "database.h"
+#include "fingerprint.h"
+#include "recorder.h"
+
+/* GLEW turns the GL entry points into macros */
+#undef glGetInternalformativ
+#undef glGetInternalformati64v
+#undef glGetInteger64v
+
+typedef void (*glx_proc)(void);
+
+/* Not including GL/glx.h, to not depend on Xlib */
+glx_proc glXGetProcAddress(const GLubyte *name);
+glx_proc glXGetProcAddressARB(const GLubyte *name);
+
+typedef void (GLAPIENTRY *get_internalformativ_proc)(GLenum target,
+                                                     GLenum internalformat,
+                                                     GLenum pname,
+                                                     GLsizei count,
+                                                     GLint *params);
+typedef void (GLAPIENTRY *get_internalformati64v_proc)(GLenum target,
+                                                       GLenum internalformat,
+                                                       GLenum pname,
+                                                       GLsizei count,
+                                                       GLint64 *params);
+typedef void (GLAPIENTRY *get_integerv_proc)(GLenum pname,
+                                             GLint *data);
+typedef void (GLAPIENTRY *get_integer64v_proc)(GLenum pname,
+                                               GLint64 *data);
+typedef void (GLAPIENTRY *get_booleanv_proc)(GLenum pname,
+                                             GLboolean *data);
+
+static struct {
+   const char *path;
+   result_db *db;
+   /* Set once the fingerprint of the driver was checked */
+   bool checked;
+   bool matches;
+
+   glx_proc (*glx_get_proc_address)(const GLubyte *name);
+   glx_proc (*glx_get_proc_address_arb)(const GLubyte *name);
+   __eglMustCastToProperFunctionPointerType (*egl_get_proc_address)
+      (const char *name);
+   get_internalformativ_proc get_internalformativ;
+   get_internalformati64v_proc get_internalformati64v;
+   get_integerv_proc get_integerv;
+   get_integer64v_proc get_integer64v;
+   get_booleanv_proc get_booleanv;
+
+   bool recording;
+   /* Set at the end of init(), so the hooks skip pthread_once */
+   atomic_bool initialized;
+
+   atomic_ullong hits;
+   atomic_ullong misses;
+} preload;
+
+static pthread_once_t init_once = PTHREAD_ONCE_INIT;
+static pthread_once_t check_once = PTHREAD_ONCE_INIT;
+
+/* Looks @name up on the libraries loaded after this one, or through
+ * the real GLX and EGL getProcAddress */
+static void*
+get_real_proc(const char *name)
+{
+   void *result = dlsym(RTLD_NEXT, name);
+
+   if (result == NULL && preload.glx_get_proc_address_arb != NULL)
+      result = (void*) preload.glx_get_proc_address_arb((const GLubyte*) name);
+   if (result == NULL && preload.egl_get_proc_address != NULL)
+      result = (void*) preload.egl_get_proc_address(name);
+
+   return result;
+}
+
+static void
+resolve_get_proc_address(void)
+{
+   if (preload.glx_get_proc_address == NULL)
+      preload.glx_get_proc_address = dlsym(RTLD_NEXT, "glXGetProcAddress");
+   if (preload.glx_get_proc_address_arb == NULL)
+      preload.glx_get_proc_address_arb =
+         dlsym(RTLD_NEXT, "glXGetProcAddressARB");
+   if (preload.egl_get_proc_address == NULL)
+      preload.egl_get_proc_address = dlsym(RTLD_NEXT, "eglGetProcAddress");
+}
+
+static void
+init(void)
+{
+   resolve_get_proc_address();
+   preload.get_internalformativ = (get_internalformativ_proc)
+      get_real_proc("glGetInternalformativ");
+   preload.get_internalformati64v = (get_internalformati64v_proc)
+      get_real_proc("glGetInternalformati64v");
+   preload.get_integerv = (get_integerv_proc) get_real_proc("glGetIntegerv");
+   preload.get_integer64v = (get_integer64v_proc)
+      get_real_proc("glGetInteger64v");
+   preload.get_booleanv = (get_booleanv_proc) get_real_proc("glGetBooleanv");
+
+   if (getenv("Q2I_RECORD") != NULL) {
+      recorder_start(getenv("Q2I_RECORD"));
+      preload.recording = true;
+   }
+
+   preload.path = getenv("Q2I_DATABASE");
+   if (preload.path != NULL) {
+      preload.db = result_db_open(preload.path);
+      if (preload.db == NULL)
+         fprintf(stderr, "query2-info preload: can't open %s\n",
+                 preload.path);
+   }
+
+   atomic_store_explicit(&preload.initialized, true, memory_order_release);
+}
+
+static inline void
+ensure_init(void)
+{
+   if (!atomic_load_explicit(&preload.initialized, memory_order_acquire))
+      pthread_once(&init_once, init);
+}
+
+/* Compares the fingerprint of the database with the one of the
+ * current context, the first time a query is done */
+static void
+check_fingerprint(void)
+{
+   fingerprint_gl_functions functions;
+   char *fingerprint;
+
+   functions.get_string = get_real_proc("glGetString");
+   functions.get_stringi = get_real_proc("glGetStringi");
+   functions.get_integerv = get_real_proc("glGetIntegerv");
+   if (functions.get_string == NULL || functions.get_stringi == NULL ||
+       functions.get_integerv == NULL)
+      return;
+
+   preload.checked = true;
+   fingerprint = fingerprint_gl_with(&functions);
+   preload.matches = fingerprint != NULL &&
+      strcmp(fingerprint, result_db_get_fingerprint(preload.db)) == 0;
+   free(fingerprint);
+}
+
+/* Returns the cell to answer the query with, or NULL if it has to go
+ * to the driver. The cells of the queries that raised an error when
+ * the database was captured are empty, so those go to the driver,
+ * that raises the error again. */
+static const result_db_cell*
+lookup(bool testing64,
+       GLenum target,
+       GLenum internalformat,
+       GLenum pname,
+       GLsizei count,
+       const void *params)
+{
+   ensure_init();
+   if (preload.db == NULL)
+      return NULL;
+
+   pthread_once(&check_once, check_fingerprint);
+   if (!preload.matches || count <= 0 || params == NULL)
+      return NULL;
+
+   return result_db_lookup(preload.db, testing64, pname, target,
+                           internalformat);
+}
+
+/* Returns the number of values of @cell to write on a buffer of
+ * @count values */
+static unsigned
+get_num_values(const result_db_cell *cell,
+               GLsizei count)
+{
+   return cell->num_values < (unsigned) count ?
+      cell->num_values : (unsigned) count;
+}
+
+static void
+record_call(enum query_log_function function,
+            GLenum target,
+            GLenum internalformat,
+            GLenum pname,
+            GLsizei count,
+            int64_t value,
+            const void *call_site)
+{
+   query_log_record record;
+
+   memset(&record, 0, sizeof(record));
+   record.function = function;
+   record.target = target;
+   record.internalformat = internalformat;
+   record.pname = pname;
+   record.count = count > 0 ? (count < UINT16_MAX ? count : UINT16_MAX) : 0;
+   record.value = value;
+
+   recorder_add(&record, call_site);
+}
+
+static void
+count_query(bool hit)
+{
+   atomic_fetch_add_explicit(hit ? &preload.hits : &preload.misses, 1,
+                             memory_order_relaxed);
+}
+
+static void
+query_internalformati64v(GLenum target,
+                         GLenum internalformat,
+                         GLenum pname,
+                         GLsizei count,
+                         GLint64 *params)
+{
+   const result_db_cell *cell = lookup(true, target, internalformat, pname,
+                                       count, params);
+
+   if (cell != NULL) {
+      const int64_t *values = result_db_get_values(preload.db, cell);
+      unsigned num_values = get_num_values(cell, count);
+
+      memcpy(params, values, num_values * sizeof(GLint64));
+      count_query(true);
+      return;
+   }
+
+   count_query(false);
+   if (preload.get_internalformati64v != NULL)
+      preload.get_internalformati64v(target, internalformat, pname, count,
+                                     params);
+}
+
+static void
+query_internalformativ(GLenum target,
+                       GLenum internalformat,
+                       GLenum pname,
+                       GLsizei count,
+                       GLint *params)
+{
+   const result_db_cell *cell = lookup(false, target, internalformat,
+                                       pname, count, params);
+
+   if (cell != NULL) {
+      const int64_t *values = result_db_get_values(preload.db, cell);
+      unsigned num_values = get_num_values(cell, count);
+      unsigned i;
+
+      /* The 32-bit query of a value that doesn't fit is up to the
+       * driver, so it is not answered from the 64-bit one, if the
+       * database has no 32-bit results */
+      for (i = 0; i < num_values; i++) {
+         if (values[i] < INT32_MIN || values[i] > INT32_MAX)
+            break;
+      }
+
+      if (i == num_values) {
+         for (i = 0; i < num_values; i++)
+            params[i] = values[i];
+         count_query(true);
+         return;
+      }
+   }
+
+   count_query(false);
+   if (preload.get_internalformativ != NULL)
+      preload.get_internalformativ(target, internalformat, pname, count,
+                                   params);
+}
+
+void GLAPIENTRY
+glGetInternalformati64v(GLenum target,
+                        GLenum internalformat,
+                        GLenum pname,
+                        GLsizei count,
+                        GLint64 *params)
+{
+   query_internalformati64v(target, internalformat, pname, count, params);
+
+   if (preload.recording)
+      record_call(QUERY_LOG_GET_INTERNALFORMATI64V, target, internalformat,
+                  pname, count, count > 0 && params ? params[0] : 0,
+                  __builtin_return_address(0));
+}
+
+void GLAPIENTRY
+glGetInternalformativ(GLenum target,
+                      GLenum internalformat,
+                      GLenum pname,
+                      GLsizei count,
+                      GLint *params)
+{
+   query_internalformativ(target, internalformat, pname, count, params);
+
+   if (preload.recording)
+      record_call(QUERY_LOG_GET_INTERNALFORMATIV, target, internalformat,
+                  pname, count, count > 0 && params ? params[0] : 0,
+                  __builtin_return_address(0));
+}
+
+/* Only replaced to record them */
+
+void GLAPIENTRY
+glGetIntegerv(GLenum pname,
+              GLint *data)
+{
+   ensure_init();
+   if (preload.get_integerv != NULL)
+      preload.get_integerv(pname, data);
+
+   if (preload.recording)
+      record_call(QUERY_LOG_GET_INTEGERV, 0, 0, pname, 0,
+                  data ? data[0] : 0, __builtin_return_address(0));
+}
+
+void GLAPIENTRY
+glGetInteger64v(GLenum pname,
+                GLint64 *data)
+{
+   ensure_init();
+   if (preload.get_integer64v != NULL)
+      preload.get_integer64v(pname, data);
+
+   if (preload.recording)
+      record_call(QUERY_LOG_GET_INTEGER64V, 0, 0, pname, 0,
+                  data ? data[0] : 0, __builtin_return_address(0));
+}
+
+void GLAPIENTRY
+glGetBooleanv(GLenum pname,
+              GLboolean *data)
+{
+   ensure_init();
+   if (preload.get_booleanv != NULL)
+      preload.get_booleanv(pname, data);
+
+   if (preload.recording)
+      record_call(QUERY_LOG_GET_BOOLEANV, 0, 0, pname, 0,
+                  data ? data[0] : 0, __builtin_return_address(0));
+}
+
+/* Returns our replacement for @name, if the driver has it, or @proc.
+ * The glGet*v hooks only record, so without Q2I_RECORD the driver's
+ * functions are returned as they are. */
+static void*
+replace_proc(const char *name,
+             void *proc)
+{
+   if (proc == NULL)
+      return NULL;
+
+   if (strcmp(name, "glGetInternalformativ") == 0)
+      return (void*) glGetInternalformativ;
+   if (strcmp(name, "glGetInternalformati64v") == 0)
+      return (void*) glGetInternalformati64v;
+
+   ensure_init();
+   if (!preload.recording)
+      return proc;
+
+   if (strcmp(name, "glGetIntegerv") == 0)
+      return (void*) glGetIntegerv;
+   if (strcmp(name, "glGetInteger64v") == 0)
+      return (void*) glGetInteger64v;
+   if (strcmp(name, "glGetBooleanv") == 0)
+      return (void*) glGetBooleanv;
+
+   return proc;
+}
+
+glx_proc
+glXGetProcAddress(const GLubyte *name)
+{
+   resolve_get_proc_address();
+   if (preload.glx_get_proc_address == NULL)
+      return NULL;
+
+   return (glx_proc) replace_proc((const char*) name, (void*)
+                                  preload.glx_get_proc_address(name));
+}
+
+glx_proc
+glXGetProcAddressARB(const GLubyte *name)
+{
+   resolve_get_proc_address();
+   if (preload.glx_get_proc_address_arb == NULL)
+      return NULL;
+
+   return (glx_proc) replace_proc((const char*) name, (void*)
+                                  preload.glx_get_proc_address_arb(name));
+}
+
+__eglMustCastToProperFunctionPointerType
+eglGetProcAddress(const char *procname)
+{
+   resolve_get_proc_address();
+   if (preload.egl_get_proc_address == NULL)
+      return NULL;
+
+   return (__eglMustCastToProperFunctionPointerType)
+      replace_proc(procname, (void*) preload.egl_get_proc_address(procname));
+}
+
+__attribute__((destructor))
+static void
+finish(void)
+{
+   if (preload.recording)
+      recorder_stop();
+
+   if (preload.path == NULL)
+      return;
+
+   fprintf(stderr, "query2-info preload: %s: %llu hits, %llu misses%s\n",
+           preload.path, (unsigned long long) atomic_load(&preload.hits),
+           (unsigned long long) atomic_load(&preload.misses),
+           preload.checked && !preload.matches ?
+           " (fingerprint mismatch)" : "");
+}
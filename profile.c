@@ -0,0 +1,342 @@
+/*
+ * Copyright © 2016 Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+/**
+ * Latency of each query of a sweep.
+ *
+ * Each query is timed with CLOCK_MONOTONIC_RAW, and added to the
+ * histogram of its pname/target, so to the one of its sweep chunk,
+ * and stored per cell, to find the slowest ones. As each chunk is run
+ * by only one thread, the parallel sweep can add to them without any
+ * lock.
+ *
+ * The histograms are log-bucketed, as the HDR ones: each power of two
+ * is split in SUB_BUCKETS linear buckets, so the error of the
+ * percentiles is bounded by 1 / SUB_BUCKETS of the value, whatever its
+ * magnitude.
+ */
+#include "profile.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "util-string.h"
+
+/* Linear buckets per power of two, as a power of two */
+#define SUB_BUCKET_BITS 3
+#define SUB_BUCKETS (1 << SUB_BUCKET_BITS)
+
+/* Enough for latencies of up to 2^40 ns (18 minutes) */
+#define MAX_EXPONENT 40
+#define NUM_BUCKETS ((MAX_EXPONENT - SUB_BUCKET_BITS + 1) * SUB_BUCKETS)
+
+typedef struct _chunk_stats {
+   uint32_t histogram[NUM_BUCKETS];
+   uint32_t count;
+   uint64_t total_ns;
+   uint64_t max_ns;
+} chunk_stats;
+
+struct _profile {
+   const GLenum *pnames;
+   unsigned num_pnames;
+   const GLenum *targets;
+   unsigned num_targets;
+   const GLenum *internalformats;
+   unsigned num_internalformats;
+   unsigned num_widths;
+
+   /* One per chunk, so per pname/target */
+   chunk_stats *chunks;
+   /* Latency of each cell, in the numbering of the sweep, or 0 if it
+    * was not queried */
+   uint64_t *cell_ns;
+};
+
+/* Percentiles of a chunk, for the report */
+typedef struct _chunk_summary {
+   unsigned chunk;
+   uint64_t p50;
+   uint64_t p99;
+} chunk_summary;
+
+static unsigned
+get_bucket(uint64_t ns)
+{
+   unsigned exponent;
+   unsigned bucket;
+
+   if (ns < SUB_BUCKETS)
+      return ns;
+
+   exponent = 63 - __builtin_clzll(ns);
+   bucket = (exponent - SUB_BUCKET_BITS + 1) * SUB_BUCKETS +
+      ((ns >> (exponent - SUB_BUCKET_BITS)) & (SUB_BUCKETS - 1));
+
+   return bucket < NUM_BUCKETS ? bucket : NUM_BUCKETS - 1;
+}
+
+/* Highest latency that goes to @bucket */
+static uint64_t
+get_bucket_limit(unsigned bucket)
+{
+   unsigned exponent;
+   uint64_t sub_bucket;
+
+   if (bucket < SUB_BUCKETS)
+      return bucket;
+
+   exponent = bucket / SUB_BUCKETS + SUB_BUCKET_BITS - 1;
+   sub_bucket = bucket % SUB_BUCKETS;
+
+   return ((SUB_BUCKETS + sub_bucket + 1) << (exponent - SUB_BUCKET_BITS)) - 1;
+}
+
+/*
+ * Creates a profile for a sweep of @pnames, @targets and
+ * @internalformats, with @num_widths widths, as the sweep_params.
+ */
+profile*
+profile_new(const GLenum *pnames,
+            unsigned num_pnames,
+            const GLenum *targets,
+            unsigned num_targets,
+            const GLenum *internalformats,
+            unsigned num_internalformats,
+            unsigned num_widths)
+{
+   profile *result = (profile*) calloc(1, sizeof(profile));
+   size_t num_chunks = (size_t) num_pnames * num_targets;
+
+   result->pnames = pnames;
+   result->num_pnames = num_pnames;
+   result->targets = targets;
+   result->num_targets = num_targets;
+   result->internalformats = internalformats;
+   result->num_internalformats = num_internalformats;
+   result->num_widths = num_widths;
+   result->chunks = (chunk_stats*) calloc(num_chunks, sizeof(chunk_stats));
+   result->cell_ns = (uint64_t*)
+      calloc(num_chunks * num_internalformats * num_widths, sizeof(uint64_t));
+
+   return result;
+}
+
+/*
+ * Frees @prof, and sets its value to NULL.
+ */
+void
+profile_clear(profile **prof)
+{
+   profile *_prof = *prof;
+
+   if (_prof == NULL)
+      return;
+
+   free(_prof->chunks);
+   free(_prof->cell_ns);
+   free(_prof);
+   *prof = NULL;
+}
+
+/*
+ * Returns the time to be passed to profile_add, in ns. The raw clock
+ * is not slewed by NTP, so the intervals are not distorted by it.
+ */
+uint64_t
+profile_now(void)
+{
+   struct timespec ts;
+
+   clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+
+   return (uint64_t) ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+/*
+ * Adds the latency @ns of the query of @cell, numbered as in the
+ * sweep. Only the thread running the chunk of @cell can call it.
+ */
+void
+profile_add(profile *prof,
+            unsigned cell,
+            uint64_t ns)
+{
+   chunk_stats *chunk =
+      &prof->chunks[cell / (prof->num_internalformats * prof->num_widths)];
+
+   chunk->histogram[get_bucket(ns)]++;
+   chunk->count++;
+   chunk->total_ns += ns;
+   if (ns > chunk->max_ns)
+      chunk->max_ns = ns;
+
+   prof->cell_ns[cell] = ns;
+}
+
+/* Upper limit of the latency of @fraction of the queries of @chunk */
+static uint64_t
+get_percentile(const chunk_stats *chunk,
+               double fraction)
+{
+   uint64_t rank = (uint64_t) (fraction * chunk->count + 0.5);
+   uint64_t seen = 0;
+   unsigned i;
+
+   if (rank == 0)
+      rank = 1;
+
+   for (i = 0; i < NUM_BUCKETS; i++) {
+      seen += chunk->histogram[i];
+      if (seen >= rank) {
+         uint64_t limit = get_bucket_limit(i);
+
+         return limit < chunk->max_ns ? limit : chunk->max_ns;
+      }
+   }
+
+   return chunk->max_ns;
+}
+
+static int
+compare_summaries(const void *a,
+                  const void *b)
+{
+   const chunk_summary *summary_a = (const chunk_summary*) a;
+   const chunk_summary *summary_b = (const chunk_summary*) b;
+
+   if (summary_a->p99 != summary_b->p99)
+      return summary_a->p99 < summary_b->p99 ? 1 : -1;
+   if (summary_a->chunk != summary_b->chunk)
+      return summary_a->chunk < summary_b->chunk ? -1 : 1;
+   return 0;
+}
+
+/* Sorts the cells by latency, slowest first, keeping the sweep order
+ * for the same latency. @cell_ns is set for the duration of qsort. */
+static const uint64_t *sorted_cell_ns;
+
+static int
+compare_cells(const void *a,
+              const void *b)
+{
+   unsigned cell_a = *(const unsigned*) a;
+   unsigned cell_b = *(const unsigned*) b;
+
+   if (sorted_cell_ns[cell_a] != sorted_cell_ns[cell_b])
+      return sorted_cell_ns[cell_a] < sorted_cell_ns[cell_b] ? 1 : -1;
+   if (cell_a != cell_b)
+      return cell_a < cell_b ? -1 : 1;
+   return 0;
+}
+
+static void
+print_cell(const profile *prof,
+           FILE *file,
+           unsigned cell)
+{
+   unsigned cells_per_chunk = prof->num_internalformats * prof->num_widths;
+   unsigned chunk = cell / cells_per_chunk;
+   unsigned format = cell % cells_per_chunk / prof->num_widths;
+   unsigned width = cell % prof->num_widths;
+   int testing64 = prof->num_widths == 1 || width == 1;
+
+   fprintf(file, "%s bit, %s, %s, %s: %llu ns\n", testing64 ? "64" : "32",
+           util_get_gl_enum_name(prof->pnames[chunk / prof->num_targets]),
+           util_get_gl_enum_name(prof->targets[chunk % prof->num_targets]),
+           util_get_gl_enum_name(prof->internalformats[format]),
+           (unsigned long long) prof->cell_ns[cell]);
+}
+
+/*
+ * Prints on @file the report of @prof: the percentiles of each
+ * pname/target, from the one with the highest p99, and the @top
+ * slowest queries.
+ */
+void
+profile_print(const profile *prof,
+              FILE *file,
+              unsigned top)
+{
+   unsigned num_chunks = prof->num_pnames * prof->num_targets;
+   unsigned num_cells =
+      num_chunks * prof->num_internalformats * prof->num_widths;
+   chunk_summary *summaries;
+   unsigned *cells;
+   unsigned num_summaries = 0;
+   unsigned num_queried = 0;
+   uint64_t total_ns = 0;
+   unsigned i;
+
+   summaries = (chunk_summary*) malloc(num_chunks * sizeof(chunk_summary));
+   for (i = 0; i < num_chunks; i++) {
+      const chunk_stats *chunk = &prof->chunks[i];
+
+      if (chunk->count == 0)
+         continue;
+
+      summaries[num_summaries].chunk = i;
+      summaries[num_summaries].p50 = get_percentile(chunk, 0.50);
+      summaries[num_summaries].p99 = get_percentile(chunk, 0.99);
+      num_summaries++;
+      num_queried += chunk->count;
+      total_ns += chunk->total_ns;
+   }
+   qsort(summaries, num_summaries, sizeof(chunk_summary), compare_summaries);
+
+   fprintf(file, "Profile: %u queries, %.3f ms querying\n", num_queried,
+           total_ns / 1e6);
+   fprintf(file, "\n%-44s %-32s %7s %9s %9s %9s\n", "pname", "target",
+           "queries", "p50 (ns)", "p99 (ns)", "max (ns)");
+   for (i = 0; i < num_summaries; i++) {
+      const chunk_stats *chunk = &prof->chunks[summaries[i].chunk];
+
+      fprintf(file, "%-44s %-32s %7u %9llu %9llu %9llu\n",
+              util_get_gl_enum_name(prof->pnames[summaries[i].chunk /
+                                                 prof->num_targets]),
+              util_get_gl_enum_name(prof->targets[summaries[i].chunk %
+                                                  prof->num_targets]),
+              chunk->count, (unsigned long long) summaries[i].p50,
+              (unsigned long long) summaries[i].p99,
+              (unsigned long long) chunk->max_ns);
+   }
+   free(summaries);
+
+   if (top > num_queried)
+      top = num_queried;
+   if (top == 0)
+      return;
+
+   cells = (unsigned*) malloc(num_cells * sizeof(unsigned));
+   for (i = 0; i < num_cells; i++)
+      cells[i] = i;
+   sorted_cell_ns = prof->cell_ns;
+   qsort(cells, num_cells, sizeof(unsigned), compare_cells);
+   sorted_cell_ns = NULL;
+
+   fprintf(file, "\nSlowest %u queries:\n", top);
+   for (i = 0; i < top; i++)
+      print_cell(prof, file, cells[i]);
+   free(cells);
+}
@@ -0,0 +1,54 @@
+/*
+ * Copyright © 2016 Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include <GL/glew.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/* Latency of each query of a sweep, with a log-bucketed histogram per
+ * pname/target. See profile.c. */
+typedef struct _profile profile;
+
+profile* profile_new(const GLenum *pnames,
+                     unsigned num_pnames,
+                     const GLenum *targets,
+                     unsigned num_targets,
+                     const GLenum *internalformats,
+                     unsigned num_internalformats,
+                     unsigned num_widths);
+
+void profile_clear(profile **prof);
+
+uint64_t profile_now(void);
+
+void profile_add(profile *prof,
+                 unsigned cell,
+                 uint64_t ns);
+
+void profile_print(const profile *prof,
+                   FILE *file,
+                   unsigned top);
+
+#endif /* PROFILE_H */
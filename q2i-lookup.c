@@ -0,0 +1,149 @@
+/*
+ * Copyright © 2016 Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+/**
+ * Small client of the public API of libquery2info (q2i.h), that
+ * creates its own context and prints the outcome of one query:
+ *
+ *   q2i-lookup <pname> <target> <internalformat>
+ *
+ * For example, q2i-lookup GL_INTERNALFORMAT_SUPPORTED GL_TEXTURE_2D
+ * GL_RGBA8. It only uses the EGL surfaceless platform.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+
+#include "q2i.h"
+
+static EGLDisplay display = EGL_NO_DISPLAY;
+static EGLContext egl_context = EGL_NO_CONTEXT;
+
+static bool
+create_context(void)
+{
+   PFNEGLGETPLATFORMDISPLAYEXTPROC get_platform_display;
+   EGLint major;
+   EGLint minor;
+
+   get_platform_display = (PFNEGLGETPLATFORMDISPLAYEXTPROC)
+      eglGetProcAddress("eglGetPlatformDisplayEXT");
+   if (get_platform_display == NULL)
+      return false;
+
+   display = get_platform_display(EGL_PLATFORM_SURFACELESS_MESA,
+                                  EGL_DEFAULT_DISPLAY, NULL);
+   if (display == EGL_NO_DISPLAY ||
+       !eglInitialize(display, &major, &minor))
+      return false;
+
+   if (!eglBindAPI(EGL_OPENGL_API))
+      return false;
+
+   egl_context = eglCreateContext(display, EGL_NO_CONFIG_KHR,
+                                  EGL_NO_CONTEXT, NULL);
+   if (egl_context == EGL_NO_CONTEXT)
+      return false;
+
+   return eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE,
+                         egl_context);
+}
+
+static void
+destroy_context(void)
+{
+   if (display == EGL_NO_DISPLAY)
+      return;
+
+   eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+   if (egl_context != EGL_NO_CONTEXT)
+      eglDestroyContext(display, egl_context);
+   eglTerminate(display);
+}
+
+int
+main(int argc,
+     char *argv[])
+{
+   GLenum enums[3];
+   q2i_sweep_options options;
+   q2i_matrix *matrix;
+   q2i_result result;
+   unsigned i;
+
+   if (argc != 4) {
+      fprintf(stderr, "Usage: %s <pname> <target> <internalformat>\n",
+              argv[0]);
+      return 1;
+   }
+
+   for (i = 0; i < 3; i++) {
+      if (!q2i_enum_value(argv[i + 1], &enums[i])) {
+         fprintf(stderr, "Unknown GL enum `%s'\n", argv[i + 1]);
+         return 1;
+      }
+   }
+
+   if (!create_context()) {
+      fprintf(stderr, "Error creating a surfaceless EGL context.\n");
+      destroy_context();
+      return 1;
+   }
+
+   memset(&options, 0, sizeof(options));
+   options.pnames = &enums[0];
+   options.num_pnames = 1;
+   options.targets = &enums[1];
+   options.num_targets = 1;
+   options.internalformats = &enums[2];
+   options.num_internalformats = 1;
+
+   matrix = q2i_sweep(&options, NULL);
+   if (matrix == NULL) {
+      fprintf(stderr, "`%s' is not a pname known by query2-info, or "
+              "GL_ARB_internalformat_query2 is not supported.\n", argv[1]);
+      destroy_context();
+      return 1;
+   }
+
+   if (!q2i_lookup(matrix, enums[0], enums[1], enums[2], true, &result)) {
+      fprintf(stderr, "The query was not run.\n");
+      q2i_matrix_clear(&matrix);
+      destroy_context();
+      return 1;
+   }
+
+   printf("%s %s %s:", q2i_enum_name(result.pname),
+          q2i_enum_name(result.target), q2i_enum_name(result.internalformat));
+   for (i = 0; i < result.num_values; i++)
+      printf(" %lld", (long long) result.values[i]);
+   printf("\n");
+
+   q2i_matrix_clear(&matrix);
+   destroy_context();
+
+   return 0;
+}
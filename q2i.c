@@ -0,0 +1,495 @@
+/*
+ * Copyright © 2016 Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+/**
+ * Public API of libquery2info.
+ *
+ * q2i_sweep runs the same sweep as query2-info, on the context current
+ * on the calling thread, passing each result to the visitor of the
+ * caller and keeping all of them on a q2i_matrix, that can be looked
+ * up or stored as a query2-info cache. query2-info itself builds the
+ * sweep_params of sweep.c, as it needs what this API doesn't have
+ * (jobs, spec rules, profiling, traces and the output formats).
+ */
+#define _GNU_SOURCE
+#include "q2i.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cache.h"
+#include "context.h"
+#include "error-tracking.h"
+#include "sweep.h"
+#include "util.h"
+#include "util-string.h"
+
+#define ARRAY_SIZE(x) (sizeof(x) / sizeof(x[0]))
+
+enum q2i_dimension {
+   DIMENSION_PNAME,
+   DIMENSION_TARGET,
+   DIMENSION_INTERNALFORMAT,
+   DIMENSION_COUNT,
+};
+
+typedef struct _dimension_entry {
+   GLenum value;
+   unsigned position;
+} dimension_entry;
+
+/* One of the lists queried, with a copy sorted by enum, for the
+ * lookups */
+typedef struct _dimension {
+   GLenum *values;
+   dimension_entry *sorted;
+   unsigned size;
+} dimension;
+
+/* Outcome of one query. The ones with more than one value have them
+ * on the overflow array, and the ones not queried have no values. */
+typedef struct _matrix_cell {
+   GLint64 value;
+   uint32_t overflow;
+   uint16_t num_values;
+} matrix_cell;
+
+struct _q2i_matrix {
+   dimension dimensions[DIMENSION_COUNT];
+   bool both_widths;
+   bool filter_supported;
+   /* Indexed by width, pname, target and internalformat */
+   matrix_cell *cells;
+   GLint64 *overflow;
+   unsigned num_overflow_values;
+   unsigned overflow_capacity;
+
+   const q2i_visitor *visitor;
+};
+
+static int
+compare_entries(const void *a,
+                const void *b)
+{
+   const dimension_entry *entry_a = (const dimension_entry*) a;
+   const dimension_entry *entry_b = (const dimension_entry*) b;
+
+   if (entry_a->value != entry_b->value)
+      return entry_a->value < entry_b->value ? -1 : 1;
+   return 0;
+}
+
+static void
+dimension_init(dimension *dim,
+               const GLenum *values,
+               unsigned size,
+               const GLenum *default_values,
+               unsigned default_size)
+{
+   unsigned i;
+
+   if (values == NULL) {
+      values = default_values;
+      size = default_size;
+   }
+
+   dim->size = size;
+   dim->values = (GLenum*) malloc(size * sizeof(GLenum));
+   dim->sorted = (dimension_entry*) malloc(size * sizeof(dimension_entry));
+   for (i = 0; i < size; i++) {
+      dim->values[i] = values[i];
+      dim->sorted[i].value = values[i];
+      dim->sorted[i].position = i;
+   }
+   qsort(dim->sorted, size, sizeof(dimension_entry), compare_entries);
+}
+
+/* Position of @value on @dim, or -1 if it is not there */
+static int
+dimension_find(const dimension *dim,
+               GLenum value)
+{
+   unsigned low = 0;
+   unsigned high = dim->size;
+
+   while (low < high) {
+      unsigned middle = low + (high - low) / 2;
+
+      if (dim->sorted[middle].value < value)
+         low = middle + 1;
+      else
+         high = middle;
+   }
+
+   if (low < dim->size && dim->sorted[low].value == value)
+      return dim->sorted[low].position;
+
+   return -1;
+}
+
+static matrix_cell*
+matrix_get_cell(const q2i_matrix *matrix,
+                int testing64,
+                unsigned p,
+                unsigned t,
+                unsigned f)
+{
+   size_t index = testing64;
+
+   index = index * matrix->dimensions[DIMENSION_PNAME].size + p;
+   index = index * matrix->dimensions[DIMENSION_TARGET].size + t;
+   index = index * matrix->dimensions[DIMENSION_INTERNALFORMAT].size + f;
+
+   return &matrix->cells[index];
+}
+
+/* Fills @public_result with @result, without copying the values */
+static void
+get_public_result(const query_result *result,
+                  q2i_result *public_result)
+{
+   public_result->pname = result->pname;
+   public_result->target = result->target;
+   public_result->internalformat = result->internalformat;
+   public_result->testing64 = result->testing64;
+   public_result->num_values = result->num_values;
+   public_result->values = result->values;
+}
+
+static void
+matrix_add_result(const query_result *result,
+                  void *user_data)
+{
+   q2i_matrix *matrix = (q2i_matrix*) user_data;
+   int p = dimension_find(&matrix->dimensions[DIMENSION_PNAME],
+                          result->pname);
+   int t = dimension_find(&matrix->dimensions[DIMENSION_TARGET],
+                          result->target);
+   int f = dimension_find(&matrix->dimensions[DIMENSION_INTERNALFORMAT],
+                          result->internalformat);
+   matrix_cell *cell = matrix_get_cell(matrix, result->testing64, p, t, f);
+
+   cell->value = result->values[0];
+   cell->num_values = result->num_values;
+
+   if (result->num_values > 1) {
+      while (matrix->num_overflow_values + result->num_values >
+             matrix->overflow_capacity) {
+         matrix->overflow_capacity = matrix->overflow_capacity ?
+            matrix->overflow_capacity * 2 : 256;
+         matrix->overflow = (GLint64*)
+            realloc(matrix->overflow,
+                    matrix->overflow_capacity * sizeof(GLint64));
+      }
+
+      cell->overflow = matrix->num_overflow_values;
+      memcpy(&matrix->overflow[matrix->num_overflow_values], result->values,
+             result->num_values * sizeof(GLint64));
+      matrix->num_overflow_values += result->num_values;
+   }
+
+   if (matrix->visitor != NULL && matrix->visitor->result != NULL) {
+      q2i_result public_result;
+
+      get_public_result(result, &public_result);
+      matrix->visitor->result(&public_result, matrix->visitor->user_data);
+   }
+}
+
+static void
+matrix_width_mismatch(const query_result *result32,
+                      const query_result *result64,
+                      void *user_data)
+{
+   q2i_matrix *matrix = (q2i_matrix*) user_data;
+   q2i_result public32;
+   q2i_result public64;
+
+   get_public_result(result32, &public32);
+   get_public_result(result64, &public64);
+   matrix->visitor->width_mismatch(&public32, &public64,
+                                   matrix->visitor->user_data);
+}
+
+/*
+ * Runs the sweep described by @options on the context current on the
+ * calling thread, passing the results to @visitor, if not NULL.
+ * Returns the matrix with all the results, or NULL if any of the
+ * pnames is not known by query2-info, or the context doesn't support
+ * GL_ARB_internalformat_query2.
+ */
+q2i_matrix*
+q2i_sweep(const q2i_sweep_options *options,
+          const q2i_visitor *visitor)
+{
+   q2i_matrix *matrix;
+   support_matrix *supported = NULL;
+   sweep_params params;
+   size_t num_cells;
+   unsigned i;
+
+   for (i = 0; options->pnames != NULL && i < options->num_pnames; i++) {
+      if (pname_descriptor_get(options->pnames[i]) == NULL)
+         return NULL;
+   }
+
+   /* The caller may have loaded the entry points already, but loading
+    * them again is harmless */
+   if (!context_load_entry_points(CONTEXT_BACKEND_AUTO) ||
+       !glewIsSupported("GL_ARB_internalformat_query2"))
+      return NULL;
+
+   error_tracking_init_context();
+
+   matrix = (q2i_matrix*) calloc(1, sizeof(q2i_matrix));
+   dimension_init(&matrix->dimensions[DIMENSION_PNAME],
+                  options->pnames, options->num_pnames,
+                  valid_pnames, ARRAY_SIZE(valid_pnames));
+   dimension_init(&matrix->dimensions[DIMENSION_TARGET],
+                  options->targets, options->num_targets,
+                  valid_targets, ARRAY_SIZE(valid_targets));
+   dimension_init(&matrix->dimensions[DIMENSION_INTERNALFORMAT],
+                  options->internalformats, options->num_internalformats,
+                  valid_internalformats, ARRAY_SIZE(valid_internalformats));
+   matrix->both_widths = options->both_widths;
+   matrix->filter_supported = options->filter_supported;
+   matrix->visitor = visitor;
+
+   num_cells = 2 * (size_t) matrix->dimensions[DIMENSION_PNAME].size *
+      matrix->dimensions[DIMENSION_TARGET].size *
+      matrix->dimensions[DIMENSION_INTERNALFORMAT].size;
+   matrix->cells = (matrix_cell*) calloc(num_cells, sizeof(matrix_cell));
+
+   if (options->filter_supported)
+      supported =
+         support_matrix_new(matrix->dimensions[DIMENSION_TARGET].values,
+                            matrix->dimensions[DIMENSION_TARGET].size,
+                            matrix->dimensions[DIMENSION_INTERNALFORMAT].values,
+                            matrix->dimensions[DIMENSION_INTERNALFORMAT].size);
+
+   memset(&params, 0, sizeof(params));
+   params.pnames = matrix->dimensions[DIMENSION_PNAME].values;
+   params.num_pnames = matrix->dimensions[DIMENSION_PNAME].size;
+   params.targets = matrix->dimensions[DIMENSION_TARGET].values;
+   params.num_targets = matrix->dimensions[DIMENSION_TARGET].size;
+   params.internalformats = matrix->dimensions[DIMENSION_INTERNALFORMAT].values;
+   params.num_internalformats =
+      matrix->dimensions[DIMENSION_INTERNALFORMAT].size;
+   params.first_testing64 = !options->both_widths;
+   params.supported = supported;
+   params.callback = matrix_add_result;
+   if (visitor != NULL && visitor->width_mismatch != NULL)
+      params.mismatch_callback = matrix_width_mismatch;
+   params.user_data = matrix;
+
+   sweep_run(&params);
+
+   matrix->visitor = NULL;
+   support_matrix_clear(&supported);
+
+   return matrix;
+}
+
+static const GLint64*
+cell_get_values(const q2i_matrix *matrix,
+                const matrix_cell *cell)
+{
+   return cell->num_values > 1 ? &matrix->overflow[cell->overflow] :
+      &cell->value;
+}
+
+/*
+ * Fills @result with the outcome of querying @pname, @target and
+ * @internalformat with the width given by @testing64. Returns false
+ * if that was not queried by the sweep.
+ */
+bool
+q2i_lookup(const q2i_matrix *matrix,
+           GLenum pname,
+           GLenum target,
+           GLenum internalformat,
+           bool testing64,
+           q2i_result *result)
+{
+   const matrix_cell *cell;
+   int p = dimension_find(&matrix->dimensions[DIMENSION_PNAME], pname);
+   int t = dimension_find(&matrix->dimensions[DIMENSION_TARGET], target);
+   int f = dimension_find(&matrix->dimensions[DIMENSION_INTERNALFORMAT],
+                          internalformat);
+
+   if (p < 0 || t < 0 || f < 0)
+      return false;
+
+   cell = matrix_get_cell(matrix, testing64, p, t, f);
+   if (cell->num_values == 0)
+      return false;
+
+   result->pname = pname;
+   result->target = target;
+   result->internalformat = internalformat;
+   result->testing64 = testing64;
+   result->num_values = cell->num_values;
+   result->values = cell_get_values(matrix, cell);
+
+   return true;
+}
+
+/*
+ * Returns the options key used by query2-info for its caches, or NULL
+ * if @matrix was queried with lists that query2-info can't use, as it
+ * only allows choosing one or all the pnames.
+ */
+static char*
+matrix_options_key(const q2i_matrix *matrix)
+{
+   const dimension *pnames = &matrix->dimensions[DIMENSION_PNAME];
+   const dimension *targets = &matrix->dimensions[DIMENSION_TARGET];
+   const dimension *internalformats =
+      &matrix->dimensions[DIMENSION_INTERNALFORMAT];
+   GLenum pname = 0;
+   char *result;
+
+   if (targets->size != ARRAY_SIZE(valid_targets) ||
+       memcmp(targets->values, valid_targets, sizeof(valid_targets)) != 0 ||
+       internalformats->size != ARRAY_SIZE(valid_internalformats) ||
+       memcmp(internalformats->values, valid_internalformats,
+              sizeof(valid_internalformats)) != 0)
+      return NULL;
+
+   if (pnames->size == 1)
+      pname = pnames->values[0];
+   else if (pnames->size != ARRAY_SIZE(valid_pnames) ||
+            memcmp(pnames->values, valid_pnames, sizeof(valid_pnames)) != 0)
+      return NULL;
+
+   /* The caller made the context, so it is reused by the default
+    * backend; the GL fingerprint tells apart the drivers it can load */
+   if (asprintf(&result, "b=%d f=%d rules=0 pname=%u backend=%s",
+                matrix->both_widths, matrix->filter_supported, pname,
+                context_backend_name(CONTEXT_BACKEND_AUTO)) < 0)
+      return NULL;
+
+   return result;
+}
+
+/*
+ * Stores the results of @matrix on the cache file at @path, as
+ * query2-info --cache does, so query2-info can print them later
+ * without a context. It needs the context that answered the queries
+ * to be current, for the driver fingerprint. Returns false on error,
+ * or if the lists queried are not ones that query2-info can use.
+ */
+bool
+q2i_matrix_save_cache(const q2i_matrix *matrix,
+                      const char *path)
+{
+   const dimension *pnames = &matrix->dimensions[DIMENSION_PNAME];
+   const dimension *targets = &matrix->dimensions[DIMENSION_TARGET];
+   const dimension *internalformats =
+      &matrix->dimensions[DIMENSION_INTERNALFORMAT];
+   result_cache_writer *writer;
+   char *options = matrix_options_key(matrix);
+   query_result result;
+   unsigned p;
+   unsigned t;
+   unsigned f;
+   int testing64;
+
+   if (options == NULL)
+      return false;
+
+   writer = result_cache_writer_new(path, options);
+   free(options);
+   if (writer == NULL)
+      return false;
+
+   /* Same order as the sweep */
+   for (p = 0; p < pnames->size; p++) {
+      for (testing64 = !matrix->both_widths; testing64 <= 1; testing64++) {
+         for (t = 0; t < targets->size; t++) {
+            for (f = 0; f < internalformats->size; f++) {
+               const matrix_cell *cell =
+                  matrix_get_cell(matrix, testing64, p, t, f);
+
+               if (cell->num_values == 0)
+                  continue;
+
+               result.descriptor = pname_descriptor_get(pnames->values[p]);
+               result.pname = pnames->values[p];
+               result.target = targets->values[t];
+               result.internalformat = internalformats->values[f];
+               result.testing64 = testing64;
+               result.num_values = cell->num_values;
+               memcpy(result.values, cell_get_values(matrix, cell),
+                      cell->num_values * sizeof(GLint64));
+               result_cache_writer_add(writer, &result);
+            }
+         }
+      }
+   }
+
+   return result_cache_writer_finish(&writer);
+}
+
+/*
+ * Frees @matrix, and sets its value to NULL.
+ */
+void
+q2i_matrix_clear(q2i_matrix **matrix)
+{
+   q2i_matrix *_matrix = *matrix;
+   unsigned i;
+
+   if (_matrix == NULL)
+      return;
+
+   for (i = 0; i < DIMENSION_COUNT; i++) {
+      free(_matrix->dimensions[i].values);
+      free(_matrix->dimensions[i].sorted);
+   }
+   free(_matrix->cells);
+   free(_matrix->overflow);
+   free(_matrix);
+   *matrix = NULL;
+}
+
+/*
+ * Returns the name of the GL enum @value, as printed by query2-info.
+ */
+const char*
+q2i_enum_name(GLenum value)
+{
+   return util_get_gl_enum_name(value);
+}
+
+/*
+ * Sets @value to the GL enum called @name. Returns false if there is
+ * none with that name.
+ */
+bool
+q2i_enum_value(const char *name,
+               GLenum *value)
+{
+   return util_get_gl_enum_value(name, value);
+}
@@ -0,0 +1,98 @@
+/*
+ * Copyright © 2016 Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+#ifndef Q2I_H
+#define Q2I_H
+
+#include <GL/glew.h>
+#include <stdbool.h>
+
+/* Public API of libquery2info, to run the sweep in-process, on a
+ * context created by the caller, and to look up its results. The rest
+ * of the headers of the library are private to query2-info. */
+
+/* What to query. The NULL lists mean all the pnames, targets or
+ * internalformats known by query2-info. */
+typedef struct _q2i_sweep_options {
+   const GLenum *pnames;
+   unsigned num_pnames;
+   const GLenum *targets;
+   unsigned num_targets;
+   const GLenum *internalformats;
+   unsigned num_internalformats;
+   /* Queries with both glGetInternalformativ and
+    * glGetInternalformati64v, instead of only the latter */
+   bool both_widths;
+   /* Skips the unsupported target/internalformat pairs */
+   bool filter_supported;
+} q2i_sweep_options;
+
+/* Outcome of one query. The values are only valid during the visitor
+ * callback, or while the matrix looked up is not cleared. */
+typedef struct _q2i_result {
+   GLenum pname;
+   GLenum target;
+   GLenum internalformat;
+   /* Queried with glGetInternalformati64v, instead of
+    * glGetInternalformativ */
+   bool testing64;
+   unsigned num_values;
+   const GLint64 *values;
+} q2i_result;
+
+/* Callbacks called during the sweep, all of them optional, from the
+ * thread that called q2i_sweep, in the order of the output of
+ * query2-info. */
+typedef struct _q2i_visitor {
+   void (*result)(const q2i_result *result,
+                  void *user_data);
+   /* Only with both_widths, for the cells where the widths differ */
+   void (*width_mismatch)(const q2i_result *result32,
+                          const q2i_result *result64,
+                          void *user_data);
+   void *user_data;
+} q2i_visitor;
+
+/* Results of a sweep, kept in memory */
+typedef struct _q2i_matrix q2i_matrix;
+
+q2i_matrix* q2i_sweep(const q2i_sweep_options *options,
+                      const q2i_visitor *visitor);
+
+bool q2i_lookup(const q2i_matrix *matrix,
+                GLenum pname,
+                GLenum target,
+                GLenum internalformat,
+                bool testing64,
+                q2i_result *result);
+
+bool q2i_matrix_save_cache(const q2i_matrix *matrix,
+                           const char *path);
+
+void q2i_matrix_clear(q2i_matrix **matrix);
+
+const char* q2i_enum_name(GLenum value);
+
+bool q2i_enum_value(const char *name,
+                    GLenum *value);
+
+#endif /* Q2I_H */
@@ -0,0 +1,448 @@
+/*
+ * Copyright © 2016 Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+/**
+ * Binary log of the capability queries done by an application.
+ *
+ * The calls are stored as fixed-size query_log_record, and the places
+ * of the application doing them are aggregated on a table of call
+ * sites, each one with the number of calls it did. The call sites are
+ * stored as module and offset, instead of addresses, so they can be
+ * matched with the symbols of the application even with ASLR.
+ *
+ * The layout is:
+ *
+ *  - query_log_header, with the offset and size of each section. All
+ *    the sections are 8 bytes aligned.
+ *  - The strings (the module names), each one NUL terminated.
+ *  - The call sites, as query_log_call_site.
+ *  - The records, as query_log_record, in the order they were added.
+ *
+ * Everything is stored with the native endianness.
+ */
+#define _GNU_SOURCE
+#include "query-log.h"
+
+#include <dlfcn.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "file-io.h"
+#include "output.h"
+
+#define QUERY_LOG_MAGIC "Q2IQYLOG"
+#define QUERY_LOG_VERSION 1
+
+/* Initial number of slots of the call site table of the writer,
+ * always a power of two */
+#define CALL_SITE_TABLE_SIZE 256
+
+enum query_log_section {
+   SECTION_STRINGS,
+   SECTION_CALL_SITES,
+   SECTION_RECORDS,
+   SECTION_COUNT,
+};
+
+typedef struct _query_log_header {
+   char magic[8];
+   uint32_t version;
+   uint32_t num_call_sites;
+   uint32_t num_records;
+   uint32_t padding;
+   file_section sections[SECTION_COUNT];
+} query_log_header;
+
+struct _query_log {
+   const char *data;
+   size_t size;
+   const query_log_header *header;
+   const char *strings;
+   const query_log_call_site *call_sites;
+   const query_log_record *records;
+};
+
+/* Call site being recorded, still as an address */
+typedef struct _call_site_entry {
+   const void *address;
+   uint32_t count;
+} call_site_entry;
+
+struct _query_log_writer {
+   char *path;
+   query_log_record *records;
+   uint32_t num_records;
+   uint32_t records_capacity;
+   call_site_entry *call_sites;
+   uint32_t num_call_sites;
+   /* Open addressing table of indices on @call_sites, plus one, by
+    * address. 0 is an empty slot. */
+   uint32_t *table;
+   uint32_t table_size;
+};
+
+static const char *function_names[QUERY_LOG_FUNCTION_COUNT] = {
+   "glGetInternalformativ",
+   "glGetInternalformati64v",
+   "glGetIntegerv",
+   "glGetInteger64v",
+   "glGetBooleanv",
+};
+
+const char*
+query_log_function_name(enum query_log_function function)
+{
+   if (function >= QUERY_LOG_FUNCTION_COUNT)
+      return "(unknown)";
+
+   return function_names[function];
+}
+
+static bool
+section_is_valid(const query_log *log,
+                 enum query_log_section section,
+                 uint64_t expected_size)
+{
+   return file_section_is_valid(&log->header->sections[section], log->size,
+                                expected_size);
+}
+
+static const void*
+section_data(const query_log *log,
+             enum query_log_section section)
+{
+   return file_section_data(log->data, &log->header->sections[section]);
+}
+
+/* Checks the header of @log, and sets up the pointers to the
+ * sections. The references between them are checked too, so the
+ * callers can follow them without checking. */
+static bool
+query_log_init(query_log *log)
+{
+   const query_log_header *header = log->header;
+   uint64_t strings_size;
+   uint32_t i;
+
+   if (log->size < sizeof(query_log_header) ||
+       memcmp(header->magic, QUERY_LOG_MAGIC, sizeof(header->magic)) != 0 ||
+       header->version != QUERY_LOG_VERSION)
+      return false;
+
+   strings_size = header->sections[SECTION_STRINGS].size;
+   if (!section_is_valid(log, SECTION_STRINGS, strings_size) ||
+       !section_is_valid(log, SECTION_CALL_SITES,
+                         (uint64_t) header->num_call_sites *
+                         sizeof(query_log_call_site)) ||
+       !section_is_valid(log, SECTION_RECORDS,
+                         (uint64_t) header->num_records *
+                         sizeof(query_log_record)))
+      return false;
+
+   log->strings = section_data(log, SECTION_STRINGS);
+   log->call_sites = section_data(log, SECTION_CALL_SITES);
+   log->records = section_data(log, SECTION_RECORDS);
+
+   if (strings_size > 0 && log->strings[strings_size - 1] != '\0')
+      return false;
+
+   for (i = 0; i < header->num_call_sites; i++) {
+      if (log->call_sites[i].module >= strings_size)
+         return false;
+   }
+
+   for (i = 0; i < header->num_records; i++) {
+      if (log->records[i].call_site >= header->num_call_sites ||
+          log->records[i].function >= QUERY_LOG_FUNCTION_COUNT)
+         return false;
+   }
+
+   return true;
+}
+
+/*
+ * Maps the log at @path. Returns NULL if it can't be read or it is not
+ * a valid one.
+ */
+query_log*
+query_log_open(const char *path)
+{
+   query_log *log;
+   const void *data;
+   size_t size;
+
+   data = file_map(path, &size);
+   if (data == NULL)
+      return NULL;
+
+   log = (query_log*) calloc(1, sizeof(query_log));
+   log->data = data;
+   log->size = size;
+   log->header = data;
+
+   if (!query_log_init(log))
+      query_log_clear(&log);
+
+   return log;
+}
+
+/*
+ * Unmaps @log, and sets its value to NULL.
+ */
+void
+query_log_clear(query_log **log)
+{
+   query_log *_log = *log;
+
+   if (_log == NULL)
+      return;
+
+   file_unmap(_log->data, _log->size);
+   free(_log);
+   *log = NULL;
+}
+
+const query_log_record*
+query_log_get_records(const query_log *log,
+                      uint32_t *num_records)
+{
+   *num_records = log->header->num_records;
+
+   return log->records;
+}
+
+const query_log_call_site*
+query_log_get_call_sites(const query_log *log,
+                         uint32_t *num_call_sites)
+{
+   *num_call_sites = log->header->num_call_sites;
+
+   return log->call_sites;
+}
+
+/*
+ * Returns the string at @offset, as referenced by the call sites.
+ */
+const char*
+query_log_get_string(const query_log *log,
+                     uint32_t offset)
+{
+   return log->strings + offset;
+}
+
+/*
+ * Starts a log for @path. Nothing is written until
+ * query_log_writer_finish.
+ */
+query_log_writer*
+query_log_writer_new(const char *path)
+{
+   query_log_writer *writer;
+
+   writer = (query_log_writer*) calloc(1, sizeof(query_log_writer));
+   writer->path = strdup(path);
+   writer->table_size = CALL_SITE_TABLE_SIZE;
+   writer->table = (uint32_t*) calloc(writer->table_size, sizeof(uint32_t));
+
+   return writer;
+}
+
+static uint32_t
+hash_address(const void *address)
+{
+   uint64_t value = (uintptr_t) address;
+
+   /* Fibonacci hashing, the low bits of code addresses are similar */
+   return (uint32_t) ((value * 0x9e3779b97f4a7c15ull) >> 32);
+}
+
+/* Returns the slot of the table for @address, either the one with its
+ * index or the empty one where it should go */
+static uint32_t*
+find_call_site(query_log_writer *writer,
+               const void *address)
+{
+   uint32_t mask = writer->table_size - 1;
+   uint32_t slot = hash_address(address) & mask;
+
+   while (writer->table[slot] != 0 &&
+          writer->call_sites[writer->table[slot] - 1].address != address)
+      slot = (slot + 1) & mask;
+
+   return &writer->table[slot];
+}
+
+/* Doubles the size of the call site table */
+static void
+grow_call_site_table(query_log_writer *writer)
+{
+   uint32_t i;
+
+   free(writer->table);
+   writer->table_size *= 2;
+   writer->table = (uint32_t*) calloc(writer->table_size, sizeof(uint32_t));
+   for (i = 0; i < writer->num_call_sites; i++)
+      *find_call_site(writer, writer->call_sites[i].address) = i + 1;
+}
+
+/*
+ * Adds @record, done from the application code at @call_site. The
+ * call_site field of @record is ignored, and set by the writer.
+ */
+void
+query_log_writer_add(query_log_writer *writer,
+                     const query_log_record *record,
+                     const void *call_site)
+{
+   uint32_t *slot = find_call_site(writer, call_site);
+   query_log_record *added;
+
+   if (*slot == 0) {
+      /* Keeping the table at most half full */
+      if (2 * (writer->num_call_sites + 1) > writer->table_size) {
+         grow_call_site_table(writer);
+         slot = find_call_site(writer, call_site);
+      }
+
+      writer->call_sites = (call_site_entry*)
+         realloc(writer->call_sites,
+                 (writer->num_call_sites + 1) * sizeof(call_site_entry));
+      writer->call_sites[writer->num_call_sites].address = call_site;
+      writer->call_sites[writer->num_call_sites].count = 0;
+      *slot = ++writer->num_call_sites;
+   }
+   writer->call_sites[*slot - 1].count++;
+
+   if (writer->num_records == writer->records_capacity) {
+      writer->records_capacity = writer->records_capacity ?
+         writer->records_capacity * 2 : 1024;
+      writer->records = (query_log_record*)
+         realloc(writer->records,
+                 writer->records_capacity * sizeof(query_log_record));
+   }
+
+   added = &writer->records[writer->num_records++];
+   *added = *record;
+   added->call_site = *slot - 1;
+}
+
+/* Returns the offset of @str on @strings, adding it if it is not
+ * there yet */
+static uint32_t
+add_string(char **strings,
+           size_t *size,
+           const char *str)
+{
+   size_t len = strlen(str) + 1;
+   size_t offset = 0;
+
+   while (offset < *size) {
+      if (strcmp(*strings + offset, str) == 0)
+         return offset;
+      offset += strlen(*strings + offset) + 1;
+   }
+
+   *strings = (char*) realloc(*strings, *size + len);
+   memcpy(*strings + *size, str, len);
+   *size += len;
+
+   return offset;
+}
+
+/*
+ * Writes the log, replacing any previous one at the path given to
+ * query_log_writer_new, and frees @writer. The call sites are resolved
+ * to module and offset now, so it should be called while the modules
+ * are still loaded. Returns false if there was any error.
+ */
+bool
+query_log_writer_finish(query_log_writer **writer)
+{
+   query_log_writer *_writer = *writer;
+   query_log_header header;
+   const void *sections[SECTION_COUNT];
+   query_log_call_site *call_sites;
+   char *strings = NULL;
+   size_t strings_size = 0;
+   atomic_file *file;
+   unsigned i;
+   bool success = false;
+
+   call_sites = (query_log_call_site*)
+      calloc(_writer->num_call_sites + 1, sizeof(query_log_call_site));
+   for (i = 0; i < _writer->num_call_sites; i++) {
+      const void *address = _writer->call_sites[i].address;
+      Dl_info info;
+
+      if (dladdr(address, &info) && info.dli_fname != NULL) {
+         call_sites[i].module = add_string(&strings, &strings_size,
+                                           info.dli_fname);
+         call_sites[i].offset = (uintptr_t) address -
+            (uintptr_t) info.dli_fbase;
+      } else {
+         call_sites[i].module = add_string(&strings, &strings_size, "");
+         call_sites[i].offset = (uintptr_t) address;
+      }
+      call_sites[i].count = _writer->call_sites[i].count;
+   }
+
+   memset(&header, 0, sizeof(header));
+   memcpy(header.magic, QUERY_LOG_MAGIC, sizeof(header.magic));
+   header.version = QUERY_LOG_VERSION;
+   header.num_call_sites = _writer->num_call_sites;
+   header.num_records = _writer->num_records;
+
+   sections[SECTION_STRINGS] = strings;
+   header.sections[SECTION_STRINGS].size = strings_size;
+   sections[SECTION_CALL_SITES] = call_sites;
+   header.sections[SECTION_CALL_SITES].size =
+      _writer->num_call_sites * sizeof(query_log_call_site);
+   sections[SECTION_RECORDS] = _writer->records;
+   header.sections[SECTION_RECORDS].size =
+      (size_t) _writer->num_records * sizeof(query_log_record);
+
+   file_sections_set_offsets(header.sections, SECTION_COUNT, sizeof(header));
+
+   file = atomic_file_new(_writer->path);
+   if (file != NULL) {
+      file_sections_append(atomic_file_get_output(file), &header,
+                           sizeof(header), header.sections, sections,
+                           SECTION_COUNT);
+      success = atomic_file_finish(&file);
+   }
+
+   if (!success)
+      fprintf(stderr, "Error writing query log `%s'.\n", _writer->path);
+
+   free(call_sites);
+   free(strings);
+   free(_writer->records);
+   free(_writer->call_sites);
+   free(_writer->table);
+   free(_writer->path);
+   free(_writer);
+   *writer = NULL;
+
+   return success;
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright © 2016 Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+#ifndef QUERY_LOG_H
+#define QUERY_LOG_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Binary log of the capability queries done by an application, written
+ * by libq2i-preload.so with Q2I_RECORD. See query-log.c for the
+ * layout. */
+
+/* The functions recorded */
+enum query_log_function {
+   QUERY_LOG_GET_INTERNALFORMATIV,
+   QUERY_LOG_GET_INTERNALFORMATI64V,
+   QUERY_LOG_GET_INTEGERV,
+   QUERY_LOG_GET_INTEGER64V,
+   QUERY_LOG_GET_BOOLEANV,
+   QUERY_LOG_FUNCTION_COUNT,
+};
+
+/* One call. @target and @internalformat are 0 for the functions that
+ * don't take them, and @count is the size of the buffer passed, or 0
+ * for the ones that don't take it. @value is the first value returned. */
+typedef struct _query_log_record {
+   /* Nanoseconds since the recording started */
+   uint64_t timestamp;
+   int64_t value;
+   uint32_t pname;
+   uint32_t target;
+   uint32_t internalformat;
+   /* Index on the call sites of the log */
+   uint32_t call_site;
+   uint16_t function;
+   uint16_t count;
+   /* Sequential number of the thread, in the order they first called */
+   uint32_t thread;
+} query_log_record;
+
+/* Place of the application doing some of the calls, as an offset on
+ * the module (the executable or a shared library) named by @module, an
+ * offset on the strings of the log. */
+typedef struct _query_log_call_site {
+   uint64_t offset;
+   uint32_t module;
+   uint32_t count;
+} query_log_call_site;
+
+typedef struct _query_log query_log;
+
+query_log* query_log_open(const char *path);
+
+void query_log_clear(query_log **log);
+
+const query_log_record* query_log_get_records(const query_log *log,
+                                              uint32_t *num_records);
+
+const query_log_call_site* query_log_get_call_sites(const query_log *log,
+                                                    uint32_t *num_call_sites);
+
+const char* query_log_get_string(const query_log *log,
+                                  uint32_t offset);
+
+const char* query_log_function_name(enum query_log_function function);
+
+typedef struct _query_log_writer query_log_writer;
+
+query_log_writer* query_log_writer_new(const char *path);
+
+void query_log_writer_add(query_log_writer *writer,
+                          const query_log_record *record,
+                          const void *call_site);
+
+bool query_log_writer_finish(query_log_writer **writer);
+
+#endif /* QUERY_LOG_H */
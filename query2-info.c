@@ -28,9 +28,54 @@
  *
  * Command line optios:
  *  -pname <pname>: Prints info for only that pname (numeric value).
+ *  --pnames <list>, --targets <list>, --formats <list>: Only queries the
+ *                  pnames, targets or internalformats on <list>, comma
+ *                  separated GL names or globs, like GL_RGBA*.
+ *  --plan <file>:  Only queries the pnames, targets and internalformats
+ *                  used by the calls recorded on <file> by the preload
+ *                  library.
  *  -b:             Prints info using (b)oth 32 and 64 bit queries. By default
  *                  it only uses the 64-bit one.
  *  -f:             Prints info (f)iltering out the unsupported internalformat.
+ *  --backend <backend>: Backend used to create the GL context (auto,
+ *                  surfaceless, gbm, osmesa or glut).
+ *  --jobs <n>:     Runs the queries on <n> threads (1 to 256), each one with
+ *                  its own context. The output is the same than with one
+ *                  thread.
+ *  --errors <mode>: How GL errors are detected (sync, debug, batched or
+ *                  none). Only sync calls glGetError after each query,
+ *                  and none doesn't check them.
+ *  --cache <file>: Reuses the results stored on <file> if they were queried
+ *                  with the same options and driver. Otherwise, runs the
+ *                  queries and stores the results there.
+ *  --refresh:      Runs the queries, and updates the cache, even if it is
+ *                  valid.
+ *  --no-error:     Uses a GL_KHR_no_error context, skipping all the GL error
+ *                  checks.
+ *  --compare <file>: Compares the results with a cache stored by a previous
+ *                  run, usually a validating one to check --no-error.
+ *  --check-widths: Like -b, also reporting the cells where the 32 and
+ *                  64-bit queries differ.
+ *  --rules:        Doesn't query the results determined by the spec.
+ *  --verify-rules: Queries them anyway, reporting the ones that differ.
+ *  --output-thread <on|off>: Formats and writes the results on another
+ *                  thread.
+ *  --format <csv|bin>: Format of the output, csv or a columnar binary
+ *                  file.
+ *  --print-bin <file>: Prints as csv a file written with --format bin.
+ *  --database <file>: Also writes the results to <file>, for the preload
+ *                  and mock libraries. The 32-bit ones only with -b.
+ *  --print-log <file>: Prints the calls recorded by the preload library.
+ *  --time-startup: Prints the time spent creating the context on stderr.
+ *  --time-sweep:   Prints the time spent running the queries on stderr.
+ *  --profile:      Prints the latency percentiles of each pname/target,
+ *                  and the slowest queries, on stderr.
+ *  --profile-top <n>: How many of the slowest queries --profile prints.
+ *  --record <file>: Records a trace of the GL queries on <file>.
+ *  --replay <file>: Answers the GL queries from a trace, without a
+ *                  context.
+ *  --trace-timeline <file>: Writes a timeline of the run, as Chrome trace
+ *                  events.
  *  -h:             Prints help.
  *
  * Note that the filtering option is based on internalformat being supported
@@ -44,81 +89,383 @@
  * Author: Alejandro Piñeiro Iglesias <apinheiro@igalia.com>
  *
  */
+#define _GNU_SOURCE
+#include <fnmatch.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
 #include <inttypes.h>  /* for PRIu64 macro */
+#include <unistd.h>
 
 #include <GL/glew.h>
 
-#include "glut_wrap.h"
+#include "cache.h"
+#include "context.h"
+#include "database.h"
+#include "error-tracking.h"
+#include "fingerprint.h"
+#include "query-log.h"
+#include "results-bin.h"
+#include "sweep.h"
+#include "timeline.h"
+#include "trace.h"
 #include "util.h"
-
-#define WINDOW_WIDTH    640
-#define WINDOW_HEIGHT   480
+#include "util-string.h"
 
 #define ARRAY_SIZE(x) (sizeof(x) / sizeof(x[0]))
 
+/* Each job has its own context and thread */
+#define MAX_JOBS 256
+
 int filter_supported = 0;
 int only_64bit_query = 1;
 int just_one_pname = 0;
 GLenum global_pname = 0;
+enum context_backend backend = CONTEXT_BACKEND_AUTO;
+int print_startup_time = 0;
+unsigned num_jobs = 1;
+const char *cache_path = NULL;
+int refresh_cache = 0;
+int no_error = 0;
+const char *compare_path = NULL;
+int print_sweep_time = 0;
+int check_widths = 0;
+/* -1 to use the output thread only if there is more than one CPU */
+int output_thread = -1;
+int binary_output = 0;
+const char *print_bin_path = NULL;
+const char *database_path = NULL;
+const char *print_log_path = NULL;
+int use_rules = 0;
+int verify_rules = 0;
+int profile_queries = 0;
+const char *record_path = NULL;
+const char *replay_path = NULL;
+const char *timeline_path = NULL;
+unsigned profile_top = 10;
+
+const char *plan_path = NULL;
+/* Names or globs given with --pnames, --targets and --formats */
+const char *pname_patterns = NULL;
+const char *target_patterns = NULL;
+const char *internalformat_patterns = NULL;
+
+/* The pnames, targets and internalformats to query, as selected by
+ * -pname, --plan and the patterns */
+bool selected_pnames[ARRAY_SIZE(valid_pnames)];
+bool selected_targets[ARRAY_SIZE(valid_targets)];
+bool selected_internalformats[ARRAY_SIZE(valid_internalformats)];
+
+/* State of the output of the results */
+typedef struct _emit_state {
+   /* Only used with --format bin, instead of printing the results */
+   result_bin_writer *bin_writer;
+   result_db_writer *db_writer;
+   result_cache_writer *cache_writer;
+   /* Results of a previous run to compare with */
+   result_cache *reference;
+   unsigned num_results;
+   unsigned num_mismatches;
+   /* Cells where the 32 and 64-bit queries differ */
+   unsigned num_width_mismatches;
+   /* Results derived by the spec rules, and how many of them differ
+    * from the query, with --verify-rules */
+   unsigned num_rule_checks;
+   unsigned num_rule_mismatches;
+} emit_state;
+
+static context *ctx = NULL;
 
 static void
 init(int argc, char *argv[])
 {
-   glutInit(&argc, argv);
-   glutInitWindowPosition(100, 0);
-   /* FIXME: check for freeglut and use initcontexprofile */
-   glutInitWindowSize(WINDOW_WIDTH, WINDOW_HEIGHT);
-   glutInitDisplayMode(GLUT_RGBA | GLUT_DOUBLE);
+   uint64_t start = get_time_ns();
+   uint64_t context_end;
+   uint64_t span_start = timeline_begin();
 
-   if (glutCreateWindow(argv[0]) == GL_FALSE) {
-      fprintf(stderr, "Error creating glut window.\n");
+   ctx = context_new(backend, no_error ? CONTEXT_FLAG_NO_ERROR : 0,
+                     argc, argv);
+   timeline_span(span_start, "setup", "context creation", "backend",
+                 context_backend_name(ctx != NULL ?
+                                      context_get_backend(ctx) : backend));
+   if (ctx == NULL) {
+      fprintf(stderr, "Error creating a GL context using the `%s' backend.\n",
+              context_backend_name(backend));
       exit(1);
    }
+   context_end = get_time_ns();
 
-   glewExperimental = GL_TRUE;
-   GLenum err = glewInit();
-   if (GLEW_OK != err) {
-      fprintf(stderr, "Error calling glewInit(): %s\n", glewGetErrorString(err));
+   span_start = timeline_begin();
+   if (!context_load_entry_points(context_get_backend(ctx)))
       exit(1);
+   timeline_span(span_start, "setup", "glewInit", NULL, NULL);
+
+   if (print_startup_time) {
+      uint64_t end = get_time_ns();
+
+      fprintf(stderr, "Startup time (%s backend): context %.3f ms, "
+              "glewInit %.3f ms, total %.3f ms\n",
+              context_backend_name(context_get_backend(ctx)),
+              (context_end - start) / 1e6, (end - context_end) / 1e6,
+              (end - start) / 1e6);
    }
 }
 
 static bool
 check_pname(const GLenum pname)
 {
-   int i;
-   for (i = 0; i < ARRAY_SIZE(valid_pnames); i++) {
-     if (pname == valid_pnames[i])
-       return true;
-   }
-   return false;
+   return pname_descriptor_get(pname) != NULL;
 }
 
 static void
 print_usage(void)
 {
-   printf("Usage: query2-info [-a] [-f] [-h] [-pname <pname>]\n");
-   printf("\t-pname <pname>: Prints info for only that pname (numeric value).\n");
+   printf("Usage: query2-info [-b] [-f] [-h] [-pname <pname>]\n\t\t   "
+          "[--backend <backend>] [--jobs <n>]\n\t\t   "
+          "[--errors <mode>] "
+          "[--cache <file> [--refresh]]\n\t\t   "
+          "[--no-error] [--compare <file>] [--check-widths]\n\t\t   "
+          "[--output-thread <on|off>]\n\t\t   "
+          "[--rules] [--verify-rules]\n\t\t   "
+          "[--format <csv|bin>] [--print-bin <file>]\n\t\t   "
+          "[--database <file>]\n\t\t   "
+          "[--pnames <list>] [--targets <list>] [--formats <list>]\n\t\t   "
+          "[--plan <file>] [--print-log <file>]\n\t\t   "
+          "[--time-startup] [--time-sweep]\n\t\t   "
+          "[--profile] [--profile-top <n>]\n\t\t   "
+          "[--record <file>] [--replay <file>]\n\t\t   "
+          "[--trace-timeline <file>]\n");
+   printf("\t-pname <pname>: Prints info for only that pname (numeric "
+          "value).\n");
+   printf("\t--pnames <list>: Only queries the pnames on <list>, comma "
+          "separated GL names\n\t\tor globs, like GL_MAX_* "
+          "(quoted for the shell).\n");
+   printf("\t--targets <list>: Same for the targets, like "
+          "GL_TEXTURE_2D*.\n");
+   printf("\t--formats <list>: Same for the internalformats, like "
+          "GL_RGBA*.\n");
    printf("\t-b: Prints info using (b)oth 32 and 64 bit queries. "
-          "By default it only uses the 64-bit one.\n");
-   printf("\t-f: Prints info (f)iltering out the unsupported internalformat.\n");
-   printf("\t\tNOTE: the filtering is based on internalformat being supported"
-          " or not,\n\t\tnot on the combination of pname/target/internalformat being "
-          "supported or not.\n");
+          "By default it only\n\t\tuses the 64-bit one.\n");
+   printf("\t-f: Prints info (f)iltering out the unsupported "
+          "internalformat.\n");
+   printf("\t\tNOTE: the filtering is based on internalformat being "
+          "supported or not,\n\t\tnot on the combination of "
+          "pname/target/internalformat being supported or not.\n");
+   printf("\t--backend <backend>: Backend used to create the GL context: "
+          "auto (default),\n\t\tsurfaceless, gbm, osmesa or glut. "
+          "Only glut needs a display server,\n\t\tand auto only tries it "
+          "when DISPLAY is set.\n");
+   printf("\t--jobs <n>: Runs the queries on <n> threads (1 to %d), each "
+          "one with its own\n\t\tcontext. Not available with the glut "
+          "backend.\n", MAX_JOBS);
+   printf("\t--errors <mode>: How GL errors are detected: sync (default) "
+          "calls glGetError\n\t\tafter each query, debug uses a "
+          "GL_KHR_debug callback, batched\n\t\tcalls glGetError once "
+          "per pname/target, and none doesn't check\n\t\tthem (as "
+          "--no-error, but on a regular context).\n");
+   printf("\t--cache <file>: Prints the results stored on <file>, without "
+          "creating a\n\t\tcontext, if they were queried with the same "
+          "options and driver.\n\t\tOtherwise runs the queries and stores "
+          "them there.\n");
+   printf("\t--refresh: Runs the queries and updates the --cache file even "
+          "if it is valid.\n");
+   printf("\t--no-error: Uses a GL_KHR_no_error context, and doesn't check "
+          "for GL errors.\n");
+   printf("\t--compare <file>: Compares the results with the ones stored "
+          "on <file> by\n\t\t--cache, using the same options and driver. "
+          "Exits with 1 if they differ.\n");
+   printf("\t--check-widths: Like -b, but also reports on stderr the "
+          "cells where the\n\t\t32 and 64-bit queries return different "
+          "values.\n");
+   printf("\t--rules: Doesn't query the results determined by the "
+          "spec, from the\n\t\tsupport of each target/internalformat "
+          "(see spec-rules.c).\n");
+   printf("\t--verify-rules: Queries the results determined by the spec "
+          "anyway, and\n\t\treports on stderr the ones that differ. "
+          "Exits with 1 if any does.\n");
+   printf("\t--output-thread <on|off>: Formats and writes the results on "
+          "another thread,\n\t\toverlapping it with the queries. By "
+          "default only if there is more\n\t\tthan one CPU.\n");
+   printf("\t--format <csv|bin>: Format of the output: csv (default), "
+          "one line per\n\t\tresult, or bin, a columnar binary file "
+          "(see results-bin.c).\n");
+   printf("\t--print-bin <file>: Prints as csv the results of a file "
+          "written with\n\t\t--format bin, without creating a "
+          "context.\n");
+   printf("\t--database <file>: Also writes the results to <file>, as "
+          "a database\n\t\tindexed by pname/target/internalformat (see "
+          "database.h), that\n\t\tlibq2i-preload.so can use to answer "
+          "the queries of other\n\t\tapplications (see preload.c). The "
+          "32-bit results are\n\t\tonly written with -b.\n");
+   printf("\t--plan <file>: Only queries the pnames, targets and "
+          "internalformats used\n\t\tby the glGetInternalformat*v calls "
+          "recorded on <file> by\n\t\tlibq2i-preload.so with Q2I_RECORD "
+          "(see preload.c).\n");
+   printf("\t--print-log <file>: Prints the calls recorded on <file>, "
+          "and the call sites\n\t\tthat did them, without creating a "
+          "context.\n");
+   printf("\t--time-startup: Prints on stderr the time spent creating "
+          "the context.\n");
+   printf("\t--time-sweep: Prints on stderr the time spent running the "
+          "queries.\n");
+   printf("\t--profile: Times each query, and prints on stderr the "
+          "p50, p99 and max\n\t\tlatency of each pname/target, and the "
+          "slowest queries.\n");
+   printf("\t--profile-top <n>: How many of the slowest queries --profile "
+          "prints (10 by\n\t\tdefault).\n");
+   printf("\t--record <file>: Records the GL queries, with the values "
+          "returned, the errors\n\t\tand how long they took, on the "
+          "trace <file> (see trace.c).\n");
+   printf("\t--replay <file>: Answers the GL queries from a trace written "
+          "with --record,\n\t\twith the same options, without creating "
+          "a context. The --cache file\n\t\tis not written. Not "
+          "available with --jobs.\n");
+   printf("\t--trace-timeline <file>: Writes a timeline of the run to "
+          "<file>, as Chrome\n\t\ttrace events, that can be opened with "
+          "Perfetto (see timeline.c).\n");
    printf("\t-h: This information.\n");
 }
 
+/*
+ * Checks if argv[*i] is the long option @name, accepting both the
+ * "--name value" and the "--name=value" forms. On success @value
+ * points to the option value, and *i is updated to the last consumed
+ * argument.
+ */
+static bool
+option_with_value(int argc, char **argv, int *i,
+                  const char *name, const char **value)
+{
+   size_t len = strlen(name);
+
+   if (strncmp(argv[*i], name, len) != 0)
+      return false;
+
+   if (argv[*i][len] == '=') {
+      *value = argv[*i] + len + 1;
+      return true;
+   }
+
+   if (argv[*i][len] == '\0' && *i + 1 < argc) {
+      *value = argv[++(*i)];
+      return true;
+   }
+
+   return false;
+}
+
 static void
 parse_args(int argc, char **argv)
 {
    int i;
+   const char *value;
 
    for (i = 1; i < argc; i++) {
-      if (strcmp(argv[i], "-pname") == 0 && i + 1 < argc) {
+      if (option_with_value(argc, argv, &i, "--backend", &value)) {
+         if (!context_backend_from_name(value, &backend)) {
+            printf("Unknown context backend `%s'\n", value);
+            print_usage();
+            exit(0);
+         }
+      } else if (option_with_value(argc, argv, &i, "--jobs", &value)) {
+         char *end;
+         unsigned long jobs;
+
+         /* strtoul would accept, and negate, a leading minus sign */
+         jobs = strtoul(value, &end, 10);
+         if (*value < '0' || *value > '9' || *end != '\0' ||
+             jobs < 1 || jobs > MAX_JOBS) {
+            printf("Invalid number of jobs `%s'\n", value);
+            print_usage();
+            exit(0);
+         }
+         num_jobs = jobs;
+      } else if (option_with_value(argc, argv, &i, "--cache", &value)) {
+         cache_path = value;
+      } else if (option_with_value(argc, argv, &i, "--errors", &value)) {
+         enum error_mode mode;
+
+         if (!error_mode_from_name(value, &mode)) {
+            printf("Unknown error mode `%s'\n", value);
+            print_usage();
+            exit(0);
+         }
+         error_tracking_set_mode(mode);
+      } else if (strcmp(argv[i], "--no-error") == 0) {
+         no_error = true;
+      } else if (option_with_value(argc, argv, &i, "--compare", &value)) {
+         compare_path = value;
+      } else if (strcmp(argv[i], "--rules") == 0) {
+         use_rules = true;
+      } else if (strcmp(argv[i], "--verify-rules") == 0) {
+         use_rules = true;
+         verify_rules = true;
+      } else if (strcmp(argv[i], "--profile") == 0) {
+         profile_queries = true;
+      } else if (option_with_value(argc, argv, &i, "--profile-top",
+                                   &value)) {
+         char *end;
+
+         profile_queries = true;
+         profile_top = strtoul(value, &end, 10);
+         if (*value == '\0' || *end != '\0') {
+            printf("Invalid --profile-top value `%s'\n", value);
+            print_usage();
+            exit(0);
+         }
+      } else if (strcmp(argv[i], "--check-widths") == 0) {
+         check_widths = true;
+         only_64bit_query = 0;
+      } else if (option_with_value(argc, argv, &i, "--output-thread",
+                                   &value)) {
+         if (strcmp(value, "on") == 0) {
+            output_thread = true;
+         } else if (strcmp(value, "off") == 0) {
+            output_thread = false;
+         } else {
+            printf("Invalid output thread mode `%s'\n", value);
+            print_usage();
+            exit(0);
+         }
+      } else if (option_with_value(argc, argv, &i, "--format", &value)) {
+         if (strcmp(value, "csv") == 0) {
+            binary_output = false;
+         } else if (strcmp(value, "bin") == 0) {
+            binary_output = true;
+         } else {
+            printf("Unknown output format `%s'\n", value);
+            print_usage();
+            exit(0);
+         }
+      } else if (option_with_value(argc, argv, &i, "--database", &value)) {
+         database_path = value;
+      } else if (option_with_value(argc, argv, &i, "--print-bin", &value)) {
+         print_bin_path = value;
+      } else if (option_with_value(argc, argv, &i, "--pnames", &value)) {
+         pname_patterns = value;
+      } else if (option_with_value(argc, argv, &i, "--targets", &value)) {
+         target_patterns = value;
+      } else if (option_with_value(argc, argv, &i, "--formats", &value)) {
+         internalformat_patterns = value;
+      } else if (option_with_value(argc, argv, &i, "--plan", &value)) {
+         plan_path = value;
+      } else if (option_with_value(argc, argv, &i, "--print-log", &value)) {
+         print_log_path = value;
+      } else if (option_with_value(argc, argv, &i, "--record", &value)) {
+         record_path = value;
+      } else if (option_with_value(argc, argv, &i, "--replay", &value)) {
+         replay_path = value;
+      } else if (option_with_value(argc, argv, &i, "--trace-timeline",
+                                   &value)) {
+         timeline_path = value;
+      } else if (strcmp(argv[i], "--time-sweep") == 0) {
+         print_sweep_time = true;
+      } else if (strcmp(argv[i], "--refresh") == 0) {
+         refresh_cache = true;
+      } else if (strcmp(argv[i], "--time-startup") == 0) {
+         print_startup_time = true;
+      } else if (strcmp(argv[i], "-pname") == 0 && i + 1 < argc) {
          global_pname = atoi(argv[i + 1]);
          if (!check_pname(global_pname)) {
             printf("Value `%i' is not a valid <pname> for "
@@ -143,79 +490,753 @@ parse_args(int argc, char **argv)
    }
 }
 
+/* FNV-1a of the selected pnames, targets and internalformats, for the
+ * options key */
+static uint64_t
+get_selection_hash(void)
+{
+   uint64_t hash = 0xcbf29ce484222325ull;
+   const bool *lists[] = {
+      selected_pnames, selected_targets, selected_internalformats,
+   };
+   const size_t sizes[] = {
+      ARRAY_SIZE(selected_pnames), ARRAY_SIZE(selected_targets),
+      ARRAY_SIZE(selected_internalformats),
+   };
+   unsigned l;
+   size_t i;
+
+   for (l = 0; l < ARRAY_SIZE(lists); l++) {
+      for (i = 0; i < sizes[l]; i++) {
+         hash ^= lists[l][i];
+         hash *= 0x100000001b3ull;
+      }
+   }
+
+   return hash;
+}
+
+/* Options that change the set of results, used to know if a cache
+ * can be reused */
+static char*
+get_options_key(void)
+{
+   char *result;
+
+   /* The results derived with --rules are not queried, so they must not
+    * be reused by, or replayed for, a run without it. --verify-rules
+    * queries all of them, as a plain run. Each backend can load another
+    * driver, so a cache is only reused with the one that wrote it */
+   if (asprintf(&result, "b=%d f=%d rules=%d pname=%u backend=%s",
+                !only_64bit_query, filter_supported,
+                use_rules && !verify_rules,
+                just_one_pname ? global_pname : 0,
+                context_backend_name(backend)) < 0)
+      return NULL;
+
+   if (plan_path != NULL || pname_patterns != NULL ||
+       target_patterns != NULL || internalformat_patterns != NULL) {
+      char *key = result;
+
+      if (asprintf(&result, "%s select=%016llx", key,
+                   (unsigned long long) get_selection_hash()) < 0)
+         result = NULL;
+      free(key);
+   }
+
+   return result;
+}
+
+static bool
+results_equal(const query_result *a,
+              const query_result *b)
+{
+   return a->pname == b->pname &&
+      a->target == b->target &&
+      a->internalformat == b->internalformat &&
+      a->testing64 == b->testing64 &&
+      a->num_values == b->num_values &&
+      memcmp(a->values, b->values, a->num_values * sizeof(GLint64)) == 0;
+}
+
+static void
+output_result(emit_state *state,
+              const query_result *result)
+{
+   if (state->bin_writer != NULL)
+      result_bin_writer_add(state->bin_writer, result);
+   else
+      print_result(output_stdout(), result);
+
+   if (state->db_writer != NULL)
+      result_db_writer_add(state->db_writer, result);
+}
+
+static void
+emit_result(const query_result *result,
+            void *user_data)
+{
+   emit_state *state = (emit_state*) user_data;
+
+   output_result(state, result);
+
+   if (state->cache_writer != NULL)
+      result_cache_writer_add(state->cache_writer, result);
+
+   if (state->reference != NULL) {
+      query_result expected;
+
+      if (!result_cache_next(state->reference, &expected) ||
+          !results_equal(result, &expected)) {
+         output_buffer *err = output_stderr();
+
+         output_buffer_append_str(err, "Mismatch with the reference: ");
+         print_result(err, result);
+         output_buffer_flush(err);
+         state->num_mismatches++;
+      }
+   }
+
+   state->num_results++;
+}
+
+static void
+emit_width_mismatch(const query_result *result32,
+                    const query_result *result64,
+                    void *user_data)
+{
+   emit_state *state = (emit_state*) user_data;
+   output_buffer *err = output_stderr();
+
+   output_buffer_append_str(err, "Width mismatch: ");
+   print_result(err, result32);
+   output_buffer_append_str(err, "                ");
+   print_result(err, result64);
+   output_buffer_flush(err);
+
+   state->num_width_mismatches++;
+}
+
+static void
+emit_rule_check(const query_result *queried,
+                const query_result *derived,
+                void *user_data)
+{
+   emit_state *state = (emit_state*) user_data;
+   output_buffer *err;
+
+   state->num_rule_checks++;
+   if (results_equal(queried, derived))
+      return;
+
+   err = output_stderr();
+   output_buffer_append_str(err, "Rule mismatch: ");
+   print_result(err, queried);
+   output_buffer_append_str(err, "         rule: ");
+   print_result(err, derived);
+   output_buffer_flush(err);
+
+   state->num_rule_mismatches++;
+}
+
+/* Creates the writers of the outputs that need all the results before
+ * writing anything */
+static void
+create_writers(emit_state *state,
+               const char *fingerprint,
+               const sweep_params *params)
+{
+   if (binary_output)
+      state->bin_writer =
+         result_bin_writer_new(fingerprint,
+                               params->pnames, params->num_pnames,
+                               params->targets, params->num_targets,
+                               params->internalformats,
+                               params->num_internalformats);
+
+   if (database_path != NULL)
+      state->db_writer =
+         result_db_writer_new(database_path, fingerprint,
+                              params->pnames, params->num_pnames,
+                              params->targets, params->num_targets,
+                              params->internalformats,
+                              params->num_internalformats);
+}
+
+/* Finishes the output and the database. Returns false if any of them
+ * couldn't be written. */
+static bool
+finish_output(emit_state *state)
+{
+   bool success = true;
+
+   /* The binary writer flushes the output itself */
+   if (state->bin_writer != NULL) {
+      if (!result_bin_writer_finish(&state->bin_writer, output_stdout())) {
+         fprintf(stderr, "Error writing the binary output.\n");
+         success = false;
+      }
+   } else if (!output_buffer_flush(output_stdout())) {
+      fprintf(stderr, "Error writing the output.\n");
+      success = false;
+   }
+
+   if (state->db_writer != NULL &&
+       !result_db_writer_finish(&state->db_writer))
+      success = false;
+
+   return success;
+}
+
+/*
+ * Prints the results stored on the cache, if it is valid, setting
+ * @success to whether the output could be written. Returns false if
+ * it is not valid.
+ */
+static bool
+print_cached_results(const char *options,
+                     const sweep_params *params,
+                     bool *success)
+{
+   result_cache *cache = result_cache_load(cache_path, options, NULL);
+   query_result result;
+   emit_state state;
+
+   if (cache == NULL)
+      return false;
+
+   memset(&state, 0, sizeof(state));
+   create_writers(&state, result_cache_get_gl_fingerprint(cache), params);
+
+   while (result_cache_next(cache, &result))
+      output_result(&state, &result);
+
+   result_cache_clear(&cache);
+   *success = finish_output(&state);
+
+   return true;
+}
+
+/*
+ * Prints as csv the results of the binary file at @path. Returns the
+ * exit code.
+ */
+static int
+print_bin_file(const char *path)
+{
+   result_bin *bin = result_bin_open(path);
+   const result_bin_columns *columns;
+   query_result result;
+   uint32_t i;
+
+   if (bin == NULL) {
+      fprintf(stderr, "`%s' is not a valid binary results file.\n", path);
+      return 1;
+   }
+
+   columns = result_bin_get_columns(bin);
+   for (i = 0; i < columns->num_results; i++) {
+      result_bin_get_result(bin, i, &result);
+      print_result(output_stdout(), &result);
+   }
+
+   result_bin_clear(&bin);
+   if (!output_buffer_flush(output_stdout())) {
+      fprintf(stderr, "Error writing the output.\n");
+      return 1;
+   }
+
+   return 0;
+}
+
+/* Position of @value on @list, or -1 if it is not there */
+static int
+find_enum(const GLenum *list,
+          unsigned size,
+          GLenum value)
+{
+   unsigned i;
+
+   for (i = 0; i < size; i++) {
+      if (list[i] == value)
+         return i;
+   }
+
+   return -1;
+}
+
+/* Unselects the enums not set on @used */
+static void
+intersect_selection(bool *selected,
+                    const bool *used,
+                    unsigned size)
+{
+   unsigned i;
+
+   for (i = 0; i < size; i++)
+      selected[i] = selected[i] && used[i];
+}
+
 /*
- * Print all the values for a given pname.
+ * Unselects the pnames, targets and internalformats not used by the
+ * glGetInternalformat*v calls of the query log at @path. The ones
+ * unknown to query2-info are ignored.
  */
 static void
-print_pname_values(const GLenum *targets, unsigned num_targets,
-                   const GLenum *internalformats, unsigned num_internalformats,
-                   const GLenum pname,
-                   test_data *data)
+select_plan(const char *path)
+{
+   bool plan_pnames[ARRAY_SIZE(valid_pnames)] = { false };
+   bool plan_targets[ARRAY_SIZE(valid_targets)] = { false };
+   bool plan_internalformats[ARRAY_SIZE(valid_internalformats)] = { false };
+   query_log *log = query_log_open(path);
+   const query_log_record *records;
+   uint32_t num_records;
+   unsigned num_calls = 0;
+   uint32_t i;
+
+   if (log == NULL) {
+      fprintf(stderr, "`%s' is not a valid query log.\n", path);
+      exit(1);
+   }
+
+   records = query_log_get_records(log, &num_records);
+   for (i = 0; i < num_records; i++) {
+      const query_log_record *record = &records[i];
+      int p;
+      int t;
+      int f;
+
+      if (record->function != QUERY_LOG_GET_INTERNALFORMATIV &&
+          record->function != QUERY_LOG_GET_INTERNALFORMATI64V)
+         continue;
+
+      p = find_enum(valid_pnames, ARRAY_SIZE(valid_pnames), record->pname);
+      t = find_enum(valid_targets, ARRAY_SIZE(valid_targets), record->target);
+      f = find_enum(valid_internalformats, ARRAY_SIZE(valid_internalformats),
+                    record->internalformat);
+      if (p < 0 || t < 0 || f < 0)
+         continue;
+
+      plan_pnames[p] = true;
+      plan_targets[t] = true;
+      plan_internalformats[f] = true;
+      num_calls++;
+   }
+
+   query_log_clear(&log);
+
+   if (num_calls == 0) {
+      fprintf(stderr, "`%s' has no glGetInternalformat*v calls to plan "
+              "the queries.\n", path);
+      exit(1);
+   }
+
+   intersect_selection(selected_pnames, plan_pnames, ARRAY_SIZE(plan_pnames));
+   intersect_selection(selected_targets, plan_targets,
+                       ARRAY_SIZE(plan_targets));
+   intersect_selection(selected_internalformats, plan_internalformats,
+                       ARRAY_SIZE(plan_internalformats));
+}
+
+/* Sets on @matched the enums of @list matched by @pattern: a GL name,
+ * resolved with the reverse enum lookup (so aliases, as the _ARB
+ * names, are accepted too), or a glob, matched with the names of all
+ * of them. Returns false if none matches. */
+static bool
+match_pattern(const char *pattern,
+              const GLenum *list,
+              unsigned size,
+              bool *matched)
 {
+   bool result = false;
+   GLenum value;
    unsigned i;
-   unsigned j;
 
-   for (i = 0; i < num_targets; i++) {
-      for (j = 0; j < num_internalformats; j++) {
-         bool filter;
+   if (strpbrk(pattern, "*?[") == NULL) {
+      int position;
 
-         filter = filter_supported ?
-            !test_data_check_supported(data, targets[i], internalformats[j]) :
-            false;
+      if (!util_get_gl_enum_value(pattern, &value))
+         return false;
 
-         if (filter)
-            continue;
+      position = find_enum(list, size, value);
+      if (position < 0)
+         return false;
 
-         /* Some queries will not modify params if unsupported. Use -1 as
-          * reference value. */
-         test_data_set_value_at_index(data, 0, -1);
-         test_data_execute(data, targets[i], internalformats[j], pname);
+      matched[position] = true;
+      return true;
+   }
 
-         check_gl_error();
+   for (i = 0; i < size; i++) {
+      if (fnmatch(pattern, util_get_gl_enum_name(list[i]), 0) == 0) {
+         matched[i] = true;
+         result = true;
+      }
+   }
 
-         print_case(targets[i], internalformats[j],
-                    pname, data);
+   return result;
+}
+
+/*
+ * Unselects the enums of @list not matched by any of the comma
+ * separated names or globs of @patterns. @what names the kind of enum,
+ * for the error when one of them doesn't match any.
+ */
+static void
+select_patterns(const char *patterns,
+                const GLenum *list,
+                unsigned size,
+                bool *selected,
+                const char *what)
+{
+   size_t len = strlen(patterns);
+   bool *matched;
+   char *copy;
+   char *saveptr = NULL;
+   char *pattern;
+
+   /* strtok_r would skip the empty patterns, selecting nothing */
+   if (len == 0 || patterns[0] == ',' || patterns[len - 1] == ',' ||
+       strstr(patterns, ",,") != NULL) {
+      printf("Invalid list of %ss `%s'.\n", what, patterns);
+      print_usage();
+      exit(0);
+   }
+
+   matched = (bool*) calloc(size, sizeof(bool));
+   copy = strdup(patterns);
+   for (pattern = strtok_r(copy, ",", &saveptr); pattern != NULL;
+        pattern = strtok_r(NULL, ",", &saveptr)) {
+      if (!match_pattern(pattern, list, size, matched)) {
+         printf("`%s' doesn't match any %s.\n", pattern, what);
+         print_usage();
+         exit(0);
       }
    }
 
+   intersect_selection(selected, matched, size);
+
+   free(copy);
+   free(matched);
+}
+
+/* Sets the selected_* lists from -pname, --plan and the patterns */
+static void
+select_enums(void)
+{
+   unsigned i;
+
+   for (i = 0; i < ARRAY_SIZE(valid_pnames); i++)
+      selected_pnames[i] = !just_one_pname || valid_pnames[i] == global_pname;
+   for (i = 0; i < ARRAY_SIZE(valid_targets); i++)
+      selected_targets[i] = true;
+   for (i = 0; i < ARRAY_SIZE(valid_internalformats); i++)
+      selected_internalformats[i] = true;
+
+   if (plan_path != NULL)
+      select_plan(plan_path);
+   if (pname_patterns != NULL)
+      select_patterns(pname_patterns, valid_pnames, ARRAY_SIZE(valid_pnames),
+                      selected_pnames, "pname");
+   if (target_patterns != NULL)
+      select_patterns(target_patterns, valid_targets,
+                      ARRAY_SIZE(valid_targets), selected_targets, "target");
+   if (internalformat_patterns != NULL)
+      select_patterns(internalformat_patterns, valid_internalformats,
+                      ARRAY_SIZE(valid_internalformats),
+                      selected_internalformats, "internalformat");
+}
+
+/* Copies to @result the enums of @list set on @selected. Returns the
+ * number copied. */
+static unsigned
+filter_list(const GLenum *list,
+            unsigned size,
+            const bool *selected,
+            GLenum *result)
+{
+   unsigned count = 0;
+   unsigned i;
+
+   for (i = 0; i < size; i++) {
+      if (selected[i])
+         result[count++] = list[i];
+   }
+
+   return count;
+}
+
+/*
+ * Prints the calls of the query log at @path, one per line, followed
+ * by the call sites that did them. Returns the exit code.
+ */
+static int
+print_log_file(const char *path)
+{
+   query_log *log = query_log_open(path);
+   const query_log_record *records;
+   const query_log_call_site *call_sites;
+   uint32_t num_records;
+   uint32_t num_call_sites;
+   uint32_t i;
+
+   if (log == NULL) {
+      fprintf(stderr, "`%s' is not a valid query log.\n", path);
+      return 1;
+   }
+
+   records = query_log_get_records(log, &num_records);
+   call_sites = query_log_get_call_sites(log, &num_call_sites);
+
+   for (i = 0; i < num_records; i++) {
+      const query_log_record *record = &records[i];
+
+      printf("%llu, %u, %s, %s, ", (unsigned long long) record->timestamp,
+             record->thread, query_log_function_name(record->function),
+             util_get_gl_enum_name(record->pname));
+      if (record->function == QUERY_LOG_GET_INTERNALFORMATIV ||
+          record->function == QUERY_LOG_GET_INTERNALFORMATI64V)
+         printf("%s, %s, %u, ", util_get_gl_enum_name(record->target),
+                util_get_gl_enum_name(record->internalformat),
+                record->count);
+      printf("%lld, #%u\n", (long long) record->value, record->call_site);
+   }
+
+   printf("\nCall sites:\n");
+   for (i = 0; i < num_call_sites; i++)
+      printf("#%u, %s+0x%llx, %u calls\n", i,
+             query_log_get_string(log, call_sites[i].module),
+             (unsigned long long) call_sites[i].offset, call_sites[i].count);
+
+   query_log_clear(&log);
+
+   return 0;
 }
 
 int
 main(int argc,
      char *argv[])
 {
-   test_data *data;
-   GLenum pname;
-   int testing64;
+   support_matrix *supported = NULL;
+   emit_state state;
+   char *options = NULL;
+   uint64_t sweep_start;
+   uint64_t sweep_span_start;
+   GLenum pnames[ARRAY_SIZE(valid_pnames)];
+   GLenum targets[ARRAY_SIZE(valid_targets)];
+   GLenum internalformats[ARRAY_SIZE(valid_internalformats)];
+   sweep_params params;
+   profile *prof = NULL;
+   bool cached_output_written;
+   int status = 0;
 
    parse_args(argc, argv);
 
-   init(argc, argv);
+   if (print_bin_path != NULL)
+      return print_bin_file(print_bin_path);
+   if (print_log_path != NULL)
+      return print_log_file(print_log_path);
 
-   if (!glewIsSupported("GL_ARB_internalformat_query2")) {
-      printf("GL_ARB_internalformat_query2 extension not found\n");
-      exit(1);
+   select_enums();
+
+   if (timeline_path != NULL)
+      timeline_start(timeline_path);
+
+   memset(&state, 0, sizeof(state));
+   memset(&params, 0, sizeof(params));
+   options = get_options_key();
+
+   params.num_pnames = filter_list(valid_pnames, ARRAY_SIZE(valid_pnames),
+                                   selected_pnames, pnames);
+   params.pnames = pnames;
+   params.num_targets = filter_list(valid_targets, ARRAY_SIZE(valid_targets),
+                                    selected_targets, targets);
+   params.targets = targets;
+   params.num_internalformats =
+      filter_list(valid_internalformats, ARRAY_SIZE(valid_internalformats),
+                  selected_internalformats, internalformats);
+   params.internalformats = internalformats;
+   params.first_testing64 = only_64bit_query;
+
+   if (cache_path != NULL && !refresh_cache && compare_path == NULL &&
+       !check_widths && !profile_queries && record_path == NULL &&
+       replay_path == NULL &&
+       print_cached_results(options, &params, &cached_output_written)) {
+      free(options);
+      if (timeline_path != NULL && !timeline_finish())
+         return 1;
+      return cached_output_written ? 0 : 1;
+   }
+
+   if (no_error)
+      error_tracking_set_mode(ERROR_MODE_NONE);
+
+   if (record_path != NULL && replay_path != NULL) {
+      printf("--record and --replay can't be used together\n");
+      print_usage();
+      exit(0);
+   }
+
+   /* There is no context for the workers */
+   if (replay_path != NULL && num_jobs > 1) {
+      printf("--replay can't be used with --jobs\n");
+      print_usage();
+      exit(0);
+   }
+
+   if (replay_path != NULL) {
+      if (!trace_replay_start(replay_path)) {
+         fprintf(stderr, "`%s' is not a valid trace.\n", replay_path);
+         exit(1);
+      }
+      if (strcmp(trace_replay_get_options(), options) != 0) {
+         fprintf(stderr, "`%s' was recorded with other options.\n",
+                 replay_path);
+         exit(1);
+      }
+   } else {
+      init(argc, argv);
+
+      if (!glewIsSupported("GL_ARB_internalformat_query2")) {
+         printf("GL_ARB_internalformat_query2 extension not found\n");
+         exit(1);
+      }
+
+      error_tracking_init_context();
+   }
+
+   if (record_path != NULL) {
+      char *fingerprint = fingerprint_gl();
+
+      if (!trace_record_start(record_path, options, fingerprint)) {
+         fprintf(stderr, "Error writing trace `%s'.\n", record_path);
+         exit(1);
+      }
+      free(fingerprint);
+   }
+
+   if (compare_path != NULL) {
+      char *fingerprint = replay_path != NULL ?
+         strdup(trace_replay_get_fingerprint()) : fingerprint_gl();
+
+      state.reference = result_cache_load(compare_path, options, fingerprint);
+      free(fingerprint);
+      if (state.reference == NULL) {
+         fprintf(stderr, "`%s' is not a valid reference for these options "
+                 "and driver.\n", compare_path);
+         exit(1);
+      }
    }
 
    /* Note that we need to create test_data after initialization, as
     * glGetInternalformat*v methods are not available until we call glewInit */
-   data = test_data_new(0, 64);
-   for (unsigned i = 0; i < ARRAY_SIZE(valid_pnames); i++) {
-      pname = valid_pnames[i];
+   if (filter_supported || use_rules) {
+      uint64_t start = timeline_begin();
 
-      /* Not really the optimal, but do their work */
-      if (just_one_pname && global_pname != pname)
-         continue;
+      supported = support_matrix_new(params.targets, params.num_targets,
+                                     params.internalformats,
+                                     params.num_internalformats);
+      timeline_span(start, "setup", "support matrix", NULL, NULL);
+   }
+
+   params.supported = filter_supported ? supported : NULL;
+   params.rules_support = use_rules ? supported : NULL;
+
+   if (binary_output || database_path != NULL) {
+      char *fingerprint = replay_path != NULL ?
+         strdup(trace_replay_get_fingerprint()) : fingerprint_gl();
+
+      create_writers(&state, fingerprint, &params);
+      free(fingerprint);
+   }
+   if (cache_path != NULL && replay_path == NULL)
+      state.cache_writer = result_cache_writer_new(cache_path, options);
+   params.callback = emit_result;
+   params.mismatch_callback = check_widths ? emit_width_mismatch : NULL;
+   params.rule_callback = verify_rules ? emit_rule_check : NULL;
+   if (output_thread < 0)
+      output_thread = sysconf(_SC_NPROCESSORS_ONLN) > 1;
+   params.output_thread = output_thread;
+   params.user_data = &state;
+   if (profile_queries) {
+      prof = profile_new(params.pnames, params.num_pnames,
+                         params.targets, params.num_targets,
+                         params.internalformats, params.num_internalformats,
+                         2 - params.first_testing64);
+      params.profile = prof;
+   }
+
+   sweep_start = get_time_ns();
+   sweep_span_start = timeline_begin();
+
+   if (num_jobs > 1 && !sweep_run_parallel(&params, ctx, num_jobs)) {
+      fprintf(stderr, "The `%s' backend can't create a context per job, "
+              "running the queries on one thread.\n",
+              context_backend_name(context_get_backend(ctx)));
+      num_jobs = 1;
+   }
+
+   if (num_jobs <= 1)
+      sweep_run(&params);
+   timeline_span_int(sweep_span_start, "sweep", "sweep", "jobs", num_jobs);
+
+   if (print_sweep_time)
+      fprintf(stderr, "Sweep time: %.3f ms for %u queries\n",
+              (get_time_ns() - sweep_start) / 1e6, state.num_results);
 
-      for (testing64 = only_64bit_query; testing64 <= 1; testing64++) {
-         test_data_set_testing64(data, testing64);
-         print_pname_values(valid_targets, ARRAY_SIZE(valid_targets),
-                            valid_internalformats, ARRAY_SIZE(valid_internalformats),
-                            pname, data);
+   if (prof != NULL) {
+      profile_print(prof, stderr, profile_top);
+      profile_clear(&prof);
+   }
+
+   if (!finish_output(&state))
+      status = 1;
+   if (state.cache_writer != NULL &&
+       !result_cache_writer_finish(&state.cache_writer))
+      status = 1;
+
+   if (record_path != NULL && !trace_record_finish())
+      exit(1);
+
+   if (timeline_path != NULL && !timeline_finish())
+      exit(1);
+
+   if (replay_path != NULL) {
+      uint32_t misses = trace_replay_finish();
+
+      if (misses > 0) {
+         fprintf(stderr, "Replay: %u queries not on `%s'.\n", misses,
+                 replay_path);
+         exit(1);
       }
    }
 
-   test_data_clear(&data);
+   if (check_widths)
+      fprintf(stderr, "Width check: %u cells, %u mismatches\n",
+              state.num_results / 2, state.num_width_mismatches);
 
-   return 0;
+   if (verify_rules) {
+      fprintf(stderr, "Rule check: %u derived results, %u mismatches\n",
+              state.num_rule_checks, state.num_rule_mismatches);
+      if (state.num_rule_mismatches > 0)
+         status = 1;
+   }
+
+   if (state.reference != NULL) {
+      query_result extra;
+
+      if (result_cache_next(state.reference, &extra))
+         state.num_mismatches++;
+      result_cache_clear(&state.reference);
+
+      fprintf(stderr, "Comparison with `%s': %u results, %u mismatches\n",
+              compare_path, state.num_results, state.num_mismatches);
+      if (state.num_mismatches > 0)
+         status = 1;
+   }
+
+   free(options);
+   support_matrix_clear(&supported);
+   context_clear(&ctx);
+
+   return status;
 }
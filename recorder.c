@@ -0,0 +1,196 @@
+/*
+ * Copyright © 2016 Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+/**
+ * Recording of the calls of an application on a query log.
+ *
+ * Each thread of the application adds its calls to its own ring, so
+ * recording a call never takes a lock or does a syscall. A recorder
+ * thread drains all the rings into a query_log_writer, that is written
+ * when the recording stops, at exit. The rings are on a lock-free list,
+ * with each thread adding its own one the first time it records a
+ * call, and they are never freed, as the recorder thread may still be
+ * reading them after their thread exits.
+ */
+#define _GNU_SOURCE
+#include "recorder.h"
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "ring.h"
+#include "util.h"
+
+/* Calls each thread can record before waiting for the recorder
+ * thread */
+#define THREAD_RING_SIZE 4096
+
+/* Time the recorder thread sleeps when it finds all the rings empty */
+#define IDLE_SLEEP_NS 1000000
+
+typedef struct _recorder_item {
+   query_log_record record;
+   const void *call_site;
+} recorder_item;
+
+typedef struct _thread_ring {
+   spsc_ring *ring;
+   uint32_t thread;
+   struct _thread_ring *next;
+} thread_ring;
+
+static struct {
+   query_log_writer *writer;
+   uint64_t start;
+   pthread_t thread;
+   atomic_bool recording;
+   atomic_bool stopping;
+   _Atomic(thread_ring*) threads;
+   atomic_uint num_threads;
+} recorder;
+
+static __thread thread_ring *current_thread;
+
+/* Moves the calls on all the rings to the writer. Returns the number
+ * of them. */
+static unsigned
+drain_rings(void)
+{
+   thread_ring *thread = atomic_load_explicit(&recorder.threads,
+                                              memory_order_acquire);
+   unsigned result = 0;
+
+   for (; thread != NULL; thread = thread->next) {
+      const recorder_item *item;
+
+      while ((item = spsc_ring_try_acquire(thread->ring)) != NULL) {
+         query_log_writer_add(recorder.writer, &item->record,
+                              item->call_site);
+         spsc_ring_release(thread->ring);
+         result++;
+      }
+   }
+
+   return result;
+}
+
+static void*
+recorder_run(void *data)
+{
+   static const struct timespec idle = { 0, IDLE_SLEEP_NS };
+
+   while (!atomic_load_explicit(&recorder.stopping, memory_order_acquire)) {
+      if (drain_rings() == 0)
+         nanosleep(&idle, NULL);
+   }
+
+   /* The calls recorded before stopping */
+   drain_rings();
+
+   return NULL;
+}
+
+/*
+ * Starts recording the calls on the log at @path, that is written by
+ * recorder_stop.
+ */
+void
+recorder_start(const char *path)
+{
+   recorder.writer = query_log_writer_new(path);
+   recorder.start = get_time_ns();
+
+   if (pthread_create(&recorder.thread, NULL, recorder_run, NULL) != 0) {
+      query_log_writer_finish(&recorder.writer);
+      return;
+   }
+
+   atomic_store_explicit(&recorder.recording, true, memory_order_release);
+}
+
+/* Returns the ring of the calling thread, creating it if needed */
+static thread_ring*
+get_thread_ring(void)
+{
+   thread_ring *thread = current_thread;
+
+   if (thread != NULL)
+      return thread;
+
+   thread = (thread_ring*) calloc(1, sizeof(thread_ring));
+   thread->ring = spsc_ring_new(sizeof(recorder_item), THREAD_RING_SIZE);
+   thread->thread = atomic_fetch_add(&recorder.num_threads, 1);
+   thread->next = atomic_load_explicit(&recorder.threads,
+                                       memory_order_relaxed);
+   while (!atomic_compare_exchange_weak_explicit(&recorder.threads,
+                                                 &thread->next, thread,
+                                                 memory_order_release,
+                                                 memory_order_relaxed))
+      ;
+
+   current_thread = thread;
+
+   return thread;
+}
+
+/*
+ * Records @record, done from the application code at @call_site. The
+ * timestamp and thread fields of @record are set by the recorder. It
+ * does nothing if the recording is not running.
+ */
+void
+recorder_add(const query_log_record *record,
+             const void *call_site)
+{
+   thread_ring *thread;
+   recorder_item *item;
+
+   if (!atomic_load_explicit(&recorder.recording, memory_order_acquire))
+      return;
+
+   thread = get_thread_ring();
+   item = spsc_ring_reserve(thread->ring);
+   item->record = *record;
+   item->record.timestamp = get_time_ns() - recorder.start;
+   item->record.thread = thread->thread;
+   item->call_site = call_site;
+   spsc_ring_commit(thread->ring);
+}
+
+/*
+ * Stops the recording, and writes the log. The calls recorded by other
+ * threads after this are lost.
+ */
+void
+recorder_stop(void)
+{
+   if (!atomic_exchange(&recorder.recording, false))
+      return;
+
+   atomic_store_explicit(&recorder.stopping, true, memory_order_release);
+   pthread_join(recorder.thread, NULL);
+   query_log_writer_finish(&recorder.writer);
+}
@@ -0,0 +1,685 @@
+/*
+ * Copyright © 2016 Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+/**
+ * Binary columnar format for the results of a sweep.
+ *
+ * Instead of one text line per result, repeating the width, pname,
+ * target and internalformat names, the file has a header with the
+ * driver fingerprint and the dictionaries of the enums used, and then
+ * one array per column, with the enums as indices on the
+ * dictionaries. Most of the queries return one value, so the values
+ * are a dense column too, and the few results with more (GL_SAMPLES)
+ * have all of them on a ragged side array.
+ *
+ * The layout is:
+ *
+ *  - result_bin_header, with the counts, and the offset and size of
+ *    each section. All the sections are 8 bytes aligned.
+ *  - STRINGS: NUL terminated strings, with the fingerprint and the
+ *    names of the enums of the dictionaries.
+ *  - One section per dictionary, with a result_bin_entry per enum.
+ *  - The pname, target and internalformat columns, as uint16_t
+ *    indices, the testing64 column, as uint8_t, and the value column,
+ *    as int64_t.
+ *  - The ragged side array: the sorted rows with more than one value
+ *    (uint32_t), the offsets of their values (uint32_t, one more than
+ *    the rows), and the values (int64_t).
+ *
+ * Everything is stored with the native endianness. The reader maps the
+ * file and points to the columns, without copying nor parsing them.
+ */
+#include "results-bin.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "file-io.h"
+#include "util-string.h"
+
+#define RESULT_BIN_MAGIC "Q2IRSBIN"
+#define RESULT_BIN_VERSION 1
+
+enum result_bin_section {
+   SECTION_STRINGS,
+   SECTION_DICTIONARIES,
+   SECTION_PNAME = SECTION_DICTIONARIES + RESULT_BIN_DICTIONARY_COUNT,
+   SECTION_TARGET,
+   SECTION_INTERNALFORMAT,
+   SECTION_TESTING64,
+   SECTION_VALUE,
+   SECTION_RAGGED_ROWS,
+   SECTION_RAGGED_OFFSETS,
+   SECTION_RAGGED_VALUES,
+   SECTION_COUNT,
+};
+
+typedef struct _result_bin_header {
+   char magic[8];
+   uint32_t version;
+   uint32_t num_results;
+   uint32_t num_ragged;
+   uint32_t num_ragged_values;
+   uint32_t dictionary_sizes[RESULT_BIN_DICTIONARY_COUNT];
+   /* Offset of the fingerprint on the strings */
+   uint32_t fingerprint;
+   uint32_t padding;
+   file_section sections[SECTION_COUNT];
+} result_bin_header;
+
+typedef struct _result_bin_entry {
+   uint32_t value;
+   /* Offset of the name on the strings */
+   uint32_t name;
+   /* pname_value_kind of the pnames, 0 for the rest */
+   uint32_t kind;
+} result_bin_entry;
+
+struct _result_bin {
+   const char *data;
+   size_t size;
+   const result_bin_header *header;
+   const char *strings;
+   const result_bin_entry *dictionaries[RESULT_BIN_DICTIONARY_COUNT];
+   result_bin_columns columns;
+   /* Descriptor of each pname of the dictionary */
+   const pname_descriptor **descriptors;
+};
+
+/* Columns built by the writer, on memory, until the sizes of all the
+ * sections are known */
+enum writer_column {
+   WRITER_COLUMN_PNAME,
+   WRITER_COLUMN_TARGET,
+   WRITER_COLUMN_INTERNALFORMAT,
+   WRITER_COLUMN_TESTING64,
+   WRITER_COLUMN_VALUE,
+   WRITER_COLUMN_RAGGED_ROWS,
+   WRITER_COLUMN_RAGGED_OFFSETS,
+   WRITER_COLUMN_RAGGED_VALUES,
+   WRITER_COLUMN_COUNT,
+};
+
+struct _result_bin_writer {
+   char *fingerprint;
+   GLenum *dictionaries[RESULT_BIN_DICTIONARY_COUNT];
+   unsigned dictionary_sizes[RESULT_BIN_DICTIONARY_COUNT];
+   unsigned dictionary_capacity;
+   /* Index of the last enum found on each dictionary */
+   unsigned last_index[RESULT_BIN_DICTIONARY_COUNT];
+
+   output_buffer *columns[WRITER_COLUMN_COUNT];
+   uint32_t num_results;
+   uint32_t num_ragged;
+   uint32_t num_ragged_values;
+};
+
+static bool
+section_is_valid(const result_bin *bin,
+                 enum result_bin_section section,
+                 uint64_t expected_size)
+{
+   return file_section_is_valid(&bin->header->sections[section], bin->size,
+                                expected_size);
+}
+
+static const void*
+section_data(const result_bin *bin,
+             enum result_bin_section section)
+{
+   return file_section_data(bin->data, &bin->header->sections[section]);
+}
+
+static bool
+dictionary_is_valid(result_bin *bin,
+                    enum result_bin_dictionary dictionary)
+{
+   uint64_t strings_size = bin->header->sections[SECTION_STRINGS].size;
+   unsigned size = bin->header->dictionary_sizes[dictionary];
+   unsigned i;
+
+   if (!section_is_valid(bin, SECTION_DICTIONARIES + dictionary,
+                         (uint64_t) size * sizeof(result_bin_entry)))
+      return false;
+
+   bin->dictionaries[dictionary] =
+      section_data(bin, SECTION_DICTIONARIES + dictionary);
+   for (i = 0; i < size; i++) {
+      if (bin->dictionaries[dictionary][i].name >= strings_size)
+         return false;
+   }
+
+   return true;
+}
+
+/* Checks the header of @bin, and sets up the pointers to the sections */
+static bool
+result_bin_init(result_bin *bin)
+{
+   const result_bin_header *header = bin->header;
+   uint64_t num_results;
+   uint64_t num_ragged;
+   uint64_t strings_size;
+   unsigned i;
+
+   if (bin->size < sizeof(result_bin_header) ||
+       memcmp(header->magic, RESULT_BIN_MAGIC, sizeof(header->magic)) != 0 ||
+       header->version != RESULT_BIN_VERSION)
+      return false;
+
+   num_results = header->num_results;
+   num_ragged = header->num_ragged;
+   strings_size = header->sections[SECTION_STRINGS].size;
+
+   if (strings_size == 0 ||
+       !section_is_valid(bin, SECTION_STRINGS, strings_size))
+      return false;
+   bin->strings = section_data(bin, SECTION_STRINGS);
+   if (bin->strings[strings_size - 1] != '\0' ||
+       header->fingerprint >= strings_size)
+      return false;
+
+   for (i = 0; i < RESULT_BIN_DICTIONARY_COUNT; i++) {
+      if (!dictionary_is_valid(bin, i))
+         return false;
+   }
+
+   if (!section_is_valid(bin, SECTION_PNAME, num_results * sizeof(uint16_t)) ||
+       !section_is_valid(bin, SECTION_TARGET, num_results * sizeof(uint16_t)) ||
+       !section_is_valid(bin, SECTION_INTERNALFORMAT,
+                         num_results * sizeof(uint16_t)) ||
+       !section_is_valid(bin, SECTION_TESTING64, num_results) ||
+       !section_is_valid(bin, SECTION_VALUE, num_results * sizeof(int64_t)) ||
+       !section_is_valid(bin, SECTION_RAGGED_ROWS,
+                         num_ragged * sizeof(uint32_t)) ||
+       !section_is_valid(bin, SECTION_RAGGED_OFFSETS,
+                         (num_ragged + 1) * sizeof(uint32_t)) ||
+       !section_is_valid(bin, SECTION_RAGGED_VALUES,
+                         header->num_ragged_values * sizeof(int64_t)))
+      return false;
+
+   bin->columns.num_results = num_results;
+   bin->columns.pname = section_data(bin, SECTION_PNAME);
+   bin->columns.target = section_data(bin, SECTION_TARGET);
+   bin->columns.internalformat = section_data(bin, SECTION_INTERNALFORMAT);
+   bin->columns.testing64 = section_data(bin, SECTION_TESTING64);
+   bin->columns.value = section_data(bin, SECTION_VALUE);
+   bin->columns.num_ragged = num_ragged;
+   bin->columns.ragged_rows = section_data(bin, SECTION_RAGGED_ROWS);
+   bin->columns.ragged_offsets = section_data(bin, SECTION_RAGGED_OFFSETS);
+   bin->columns.ragged_values = section_data(bin, SECTION_RAGGED_VALUES);
+
+   /* The indices are checked here, so the users of the columns can
+    * trust them */
+   for (i = 0; i < num_results; i++) {
+      if (bin->columns.pname[i] >=
+          header->dictionary_sizes[RESULT_BIN_DICTIONARY_PNAMES] ||
+          bin->columns.target[i] >=
+          header->dictionary_sizes[RESULT_BIN_DICTIONARY_TARGETS] ||
+          bin->columns.internalformat[i] >=
+          header->dictionary_sizes[RESULT_BIN_DICTIONARY_INTERNALFORMATS])
+         return false;
+   }
+
+   for (i = 0; i < num_ragged; i++) {
+      if (bin->columns.ragged_rows[i] >= num_results ||
+          (i > 0 &&
+           bin->columns.ragged_rows[i] <= bin->columns.ragged_rows[i - 1]) ||
+          bin->columns.ragged_offsets[i] >=
+          bin->columns.ragged_offsets[i + 1] ||
+          bin->columns.ragged_offsets[i + 1] - bin->columns.ragged_offsets[i] >
+          QUERY_RESULT_MAX_VALUES)
+         return false;
+   }
+   if (bin->columns.ragged_offsets[0] != 0 ||
+       bin->columns.ragged_offsets[num_ragged] != header->num_ragged_values)
+      return false;
+
+   bin->descriptors = (const pname_descriptor**)
+      malloc(header->dictionary_sizes[RESULT_BIN_DICTIONARY_PNAMES] *
+             sizeof(pname_descriptor*));
+   for (i = 0; i < header->dictionary_sizes[RESULT_BIN_DICTIONARY_PNAMES]; i++)
+      bin->descriptors[i] = pname_descriptor_get(
+         bin->dictionaries[RESULT_BIN_DICTIONARY_PNAMES][i].value);
+
+   return true;
+}
+
+/*
+ * Maps the binary results file at @path. Returns NULL if it can't be
+ * read or it is not a valid one.
+ */
+result_bin*
+result_bin_open(const char *path)
+{
+   result_bin *bin;
+   const void *data;
+   size_t size;
+
+   data = file_map(path, &size);
+   if (data == NULL)
+      return NULL;
+
+   bin = (result_bin*) calloc(1, sizeof(result_bin));
+   bin->data = data;
+   bin->size = size;
+   bin->header = data;
+
+   if (!result_bin_init(bin))
+      result_bin_clear(&bin);
+
+   return bin;
+}
+
+/*
+ * Unmaps @bin, and sets its value to NULL.
+ */
+void
+result_bin_clear(result_bin **bin)
+{
+   result_bin *_bin = *bin;
+
+   if (_bin == NULL)
+      return;
+
+   free(_bin->descriptors);
+   file_unmap(_bin->data, _bin->size);
+   free(_bin);
+   *bin = NULL;
+}
+
+/*
+ * Returns the GL fingerprint of the driver that answered the queries.
+ */
+const char*
+result_bin_get_fingerprint(const result_bin *bin)
+{
+   return bin->strings + bin->header->fingerprint;
+}
+
+const result_bin_columns*
+result_bin_get_columns(const result_bin *bin)
+{
+   return &bin->columns;
+}
+
+unsigned
+result_bin_get_dictionary_size(const result_bin *bin,
+                               enum result_bin_dictionary dictionary)
+{
+   return bin->header->dictionary_sizes[dictionary];
+}
+
+GLenum
+result_bin_get_enum(const result_bin *bin,
+                    enum result_bin_dictionary dictionary,
+                    unsigned index)
+{
+   return bin->dictionaries[dictionary][index].value;
+}
+
+const char*
+result_bin_get_enum_name(const result_bin *bin,
+                         enum result_bin_dictionary dictionary,
+                         unsigned index)
+{
+   return bin->strings + bin->dictionaries[dictionary][index].name;
+}
+
+/*
+ * Fills @result with the result at @row, that must be lower than the
+ * number of results. This copies the values, so it is just a helper
+ * for the users that want the same results than the sweep.
+ */
+void
+result_bin_get_result(const result_bin *bin,
+                      uint32_t row,
+                      query_result *result)
+{
+   const result_bin_columns *columns = &bin->columns;
+   unsigned pname_index = columns->pname[row];
+   uint32_t low = 0;
+   uint32_t high = columns->num_ragged;
+
+   result->descriptor = bin->descriptors[pname_index];
+   result->pname =
+      bin->dictionaries[RESULT_BIN_DICTIONARY_PNAMES][pname_index].value;
+   result->target = bin->dictionaries[RESULT_BIN_DICTIONARY_TARGETS]
+      [columns->target[row]].value;
+   result->internalformat =
+      bin->dictionaries[RESULT_BIN_DICTIONARY_INTERNALFORMATS]
+      [columns->internalformat[row]].value;
+   result->testing64 = columns->testing64[row];
+   result->num_values = 1;
+   result->values[0] = columns->value[row];
+
+   while (low < high) {
+      uint32_t middle = low + (high - low) / 2;
+
+      if (columns->ragged_rows[middle] < row)
+         low = middle + 1;
+      else
+         high = middle;
+   }
+
+   if (low < columns->num_ragged && columns->ragged_rows[low] == row) {
+      uint32_t start = columns->ragged_offsets[low];
+
+      result->num_values = columns->ragged_offsets[low + 1] - start;
+      memcpy(result->values, &columns->ragged_values[start],
+             result->num_values * sizeof(int64_t));
+   }
+}
+
+static void
+dictionary_add(result_bin_writer *writer,
+               enum result_bin_dictionary dictionary,
+               const GLenum *values,
+               unsigned num_values)
+{
+   writer->dictionaries[dictionary] = (GLenum*)
+      malloc(num_values * sizeof(GLenum));
+   memcpy(writer->dictionaries[dictionary], values,
+          num_values * sizeof(GLenum));
+   writer->dictionary_sizes[dictionary] = num_values;
+}
+
+/*
+ * Starts a binary results file, for the results of querying @pnames,
+ * @targets and @internalformats, on the driver with the GL
+ * @fingerprint. Nothing is written until result_bin_writer_finish.
+ */
+result_bin_writer*
+result_bin_writer_new(const char *fingerprint,
+                      const GLenum *pnames,
+                      unsigned num_pnames,
+                      const GLenum *targets,
+                      unsigned num_targets,
+                      const GLenum *internalformats,
+                      unsigned num_internalformats)
+{
+   result_bin_writer *writer;
+   unsigned i;
+
+   writer = (result_bin_writer*) calloc(1, sizeof(result_bin_writer));
+   writer->fingerprint = strdup(fingerprint ? fingerprint : "");
+   dictionary_add(writer, RESULT_BIN_DICTIONARY_PNAMES, pnames, num_pnames);
+   dictionary_add(writer, RESULT_BIN_DICTIONARY_TARGETS, targets, num_targets);
+   dictionary_add(writer, RESULT_BIN_DICTIONARY_INTERNALFORMATS,
+                  internalformats, num_internalformats);
+   writer->dictionary_capacity = 64;
+   writer->dictionaries[RESULT_BIN_DICTIONARY_VALUE_ENUMS] = (GLenum*)
+      malloc(writer->dictionary_capacity * sizeof(GLenum));
+
+   for (i = 0; i < WRITER_COLUMN_COUNT; i++)
+      writer->columns[i] = output_buffer_new(-1);
+
+   return writer;
+}
+
+/* Returns the index of @value on @dictionary. The results follow the
+ * order of the sweep, so it is usually the last one found, or the next
+ * one. */
+static uint16_t
+dictionary_find(result_bin_writer *writer,
+                enum result_bin_dictionary dictionary,
+                GLenum value)
+{
+   const GLenum *values = writer->dictionaries[dictionary];
+   unsigned size = writer->dictionary_sizes[dictionary];
+   unsigned last = writer->last_index[dictionary];
+   unsigned i;
+
+   if (values[last] == value)
+      return last;
+   if (last + 1 < size && values[last + 1] == value) {
+      writer->last_index[dictionary] = last + 1;
+      return last + 1;
+   }
+
+   for (i = 0; i < size; i++) {
+      if (values[i] == value) {
+         writer->last_index[dictionary] = i;
+         return i;
+      }
+   }
+
+   return UINT16_MAX;
+}
+
+/* Adds @value to the sorted dictionary of the value enums, if it is
+ * not already there */
+static void
+value_enums_add(result_bin_writer *writer,
+                GLenum value)
+{
+   GLenum *values = writer->dictionaries[RESULT_BIN_DICTIONARY_VALUE_ENUMS];
+   unsigned size = writer->dictionary_sizes[RESULT_BIN_DICTIONARY_VALUE_ENUMS];
+   unsigned low = 0;
+   unsigned high = size;
+
+   while (low < high) {
+      unsigned middle = low + (high - low) / 2;
+
+      if (values[middle] < value)
+         low = middle + 1;
+      else
+         high = middle;
+   }
+
+   if (low < size && values[low] == value)
+      return;
+
+   if (size == writer->dictionary_capacity) {
+      writer->dictionary_capacity *= 2;
+      values = (GLenum*) realloc(values, writer->dictionary_capacity *
+                                 sizeof(GLenum));
+      writer->dictionaries[RESULT_BIN_DICTIONARY_VALUE_ENUMS] = values;
+   }
+
+   memmove(&values[low + 1], &values[low], (size - low) * sizeof(GLenum));
+   values[low] = value;
+   writer->dictionary_sizes[RESULT_BIN_DICTIONARY_VALUE_ENUMS]++;
+}
+
+/*
+ * Adds @result, that must be one for the pnames, targets and
+ * internalformats given to result_bin_writer_new.
+ */
+void
+result_bin_writer_add(result_bin_writer *writer,
+                      const query_result *result)
+{
+   uint16_t pname = dictionary_find(writer, RESULT_BIN_DICTIONARY_PNAMES,
+                                    result->pname);
+   uint16_t target = dictionary_find(writer, RESULT_BIN_DICTIONARY_TARGETS,
+                                     result->target);
+   uint16_t internalformat =
+      dictionary_find(writer, RESULT_BIN_DICTIONARY_INTERNALFORMATS,
+                      result->internalformat);
+   uint8_t testing64 = result->testing64;
+   int64_t value = result->values[0];
+
+   output_buffer_append(writer->columns[WRITER_COLUMN_PNAME],
+                        (const char*) &pname, sizeof(pname));
+   output_buffer_append(writer->columns[WRITER_COLUMN_TARGET],
+                        (const char*) &target, sizeof(target));
+   output_buffer_append(writer->columns[WRITER_COLUMN_INTERNALFORMAT],
+                        (const char*) &internalformat, sizeof(internalformat));
+   output_buffer_append(writer->columns[WRITER_COLUMN_TESTING64],
+                        (const char*) &testing64, sizeof(testing64));
+   output_buffer_append(writer->columns[WRITER_COLUMN_VALUE],
+                        (const char*) &value, sizeof(value));
+
+   if (result->descriptor != NULL &&
+       result->descriptor->kind == PNAME_VALUE_ENUM && value != 0)
+      value_enums_add(writer, value);
+
+   if (result->num_values > 1) {
+      if (writer->num_ragged == 0)
+         output_buffer_append(writer->columns[WRITER_COLUMN_RAGGED_OFFSETS],
+                              (const char*) &writer->num_ragged_values,
+                              sizeof(uint32_t));
+
+      output_buffer_append(writer->columns[WRITER_COLUMN_RAGGED_ROWS],
+                           (const char*) &writer->num_results,
+                           sizeof(uint32_t));
+      output_buffer_append(writer->columns[WRITER_COLUMN_RAGGED_VALUES],
+                           (const char*) result->values,
+                           result->num_values * sizeof(int64_t));
+      writer->num_ragged_values += result->num_values;
+      output_buffer_append(writer->columns[WRITER_COLUMN_RAGGED_OFFSETS],
+                           (const char*) &writer->num_ragged_values,
+                           sizeof(uint32_t));
+      writer->num_ragged++;
+   }
+
+   writer->num_results++;
+}
+
+/* Appends to @strings the name of each enum of @dictionary, filling
+ * @entries */
+static void
+write_dictionary_names(result_bin_writer *writer,
+                       enum result_bin_dictionary dictionary,
+                       output_buffer *strings,
+                       uint32_t *strings_size,
+                       result_bin_entry *entries)
+{
+   unsigned i;
+
+   for (i = 0; i < writer->dictionary_sizes[dictionary]; i++) {
+      GLenum value = writer->dictionaries[dictionary][i];
+      size_t length;
+      const char *name = util_get_gl_enum_name_with_length(value, &length);
+
+      entries[i].value = value;
+      entries[i].name = *strings_size;
+      entries[i].kind = 0;
+      if (dictionary == RESULT_BIN_DICTIONARY_PNAMES) {
+         const pname_descriptor *descriptor = pname_descriptor_get(value);
+
+         if (descriptor != NULL)
+            entries[i].kind = descriptor->kind;
+      }
+
+      output_buffer_append(strings, name, length + 1);
+      *strings_size += length + 1;
+   }
+}
+
+/*
+ * Writes the file to @out, and frees @writer. Returns false if there
+ * was any error writing it.
+ */
+bool
+result_bin_writer_finish(result_bin_writer **writer,
+                         output_buffer *out)
+{
+   result_bin_writer *_writer = *writer;
+   result_bin_header header;
+   result_bin_entry *entries[RESULT_BIN_DICTIONARY_COUNT];
+   const output_buffer *sections[SECTION_COUNT];
+   output_buffer *strings = output_buffer_new(-1);
+   uint32_t strings_size;
+   uint32_t zero = 0;
+   size_t offset;
+   unsigned i;
+   bool success;
+
+   memset(&header, 0, sizeof(header));
+   memcpy(header.magic, RESULT_BIN_MAGIC, sizeof(header.magic));
+   header.version = RESULT_BIN_VERSION;
+   header.num_results = _writer->num_results;
+   header.num_ragged = _writer->num_ragged;
+   header.num_ragged_values = _writer->num_ragged_values;
+
+   if (_writer->num_ragged == 0)
+      output_buffer_append(_writer->columns[WRITER_COLUMN_RAGGED_OFFSETS],
+                           (const char*) &zero, sizeof(zero));
+
+   header.fingerprint = 0;
+   strings_size = strlen(_writer->fingerprint) + 1;
+   output_buffer_append(strings, _writer->fingerprint, strings_size);
+   for (i = 0; i < RESULT_BIN_DICTIONARY_COUNT; i++) {
+      header.dictionary_sizes[i] = _writer->dictionary_sizes[i];
+      entries[i] = (result_bin_entry*)
+         calloc(_writer->dictionary_sizes[i] + 1, sizeof(result_bin_entry));
+      write_dictionary_names(_writer, i, strings, &strings_size, entries[i]);
+   }
+
+   header.sections[SECTION_STRINGS].size = strings_size;
+   for (i = 0; i < RESULT_BIN_DICTIONARY_COUNT; i++)
+      header.sections[SECTION_DICTIONARIES + i].size =
+         _writer->dictionary_sizes[i] * sizeof(result_bin_entry);
+   header.sections[SECTION_PNAME].size =
+      _writer->num_results * sizeof(uint16_t);
+   header.sections[SECTION_TARGET].size =
+      _writer->num_results * sizeof(uint16_t);
+   header.sections[SECTION_INTERNALFORMAT].size =
+      _writer->num_results * sizeof(uint16_t);
+   header.sections[SECTION_TESTING64].size = _writer->num_results;
+   header.sections[SECTION_VALUE].size =
+      _writer->num_results * sizeof(int64_t);
+   header.sections[SECTION_RAGGED_ROWS].size =
+      _writer->num_ragged * sizeof(uint32_t);
+   header.sections[SECTION_RAGGED_OFFSETS].size =
+      (_writer->num_ragged + 1) * sizeof(uint32_t);
+   header.sections[SECTION_RAGGED_VALUES].size =
+      _writer->num_ragged_values * sizeof(int64_t);
+
+   file_sections_set_offsets(header.sections, SECTION_COUNT, sizeof(header));
+
+   sections[SECTION_STRINGS] = strings;
+   for (i = 0; i < RESULT_BIN_DICTIONARY_COUNT; i++)
+      sections[SECTION_DICTIONARIES + i] = NULL;
+   for (i = 0; i < WRITER_COLUMN_COUNT; i++)
+      sections[SECTION_PNAME + i] = _writer->columns[i];
+
+   offset = sizeof(header);
+   output_buffer_append(out, (const char*) &header, sizeof(header));
+   for (i = 0; i < SECTION_COUNT; i++) {
+      file_section_append_padding(out, &offset);
+      if (sections[i] != NULL)
+         output_buffer_append_buffer(out, sections[i]);
+      else
+         output_buffer_append(out,
+                              (const char*) entries[i - SECTION_DICTIONARIES],
+                              header.sections[i].size);
+      offset += header.sections[i].size;
+   }
+   success = output_buffer_flush(out);
+
+   for (i = 0; i < RESULT_BIN_DICTIONARY_COUNT; i++) {
+      free(entries[i]);
+      free(_writer->dictionaries[i]);
+   }
+   for (i = 0; i < WRITER_COLUMN_COUNT; i++)
+      output_buffer_clear(&_writer->columns[i]);
+   output_buffer_clear(&strings);
+   free(_writer->fingerprint);
+   free(_writer);
+   *writer = NULL;
+
+   return success;
+}
@@ -0,0 +1,107 @@
+/*
+ * Copyright © 2016 Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+#ifndef RESULTS_BIN_H
+#define RESULTS_BIN_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "output.h"
+#include "util.h"
+
+/* Binary columnar format for the results of a sweep, written with
+ * --format bin. See results-bin.c for the layout. */
+
+/* Columns of a binary results file, pointing to the mapped file. Row i
+ * is the result of querying pname[i], target[i] and internalformat[i],
+ * being those indices on the dictionaries of the file, with the width
+ * given by testing64[i]. value[i] is its first value. The rows with
+ * more than one value are listed, sorted, on ragged_rows, with all
+ * their values on ragged_values, from ragged_offsets[j] to
+ * ragged_offsets[j + 1]. */
+typedef struct _result_bin_columns {
+   uint32_t num_results;
+   const uint16_t *pname;
+   const uint16_t *target;
+   const uint16_t *internalformat;
+   const uint8_t *testing64;
+   const int64_t *value;
+
+   uint32_t num_ragged;
+   const uint32_t *ragged_rows;
+   const uint32_t *ragged_offsets;
+   const int64_t *ragged_values;
+} result_bin_columns;
+
+/* Dictionaries of a binary results file */
+enum result_bin_dictionary {
+   RESULT_BIN_DICTIONARY_PNAMES,
+   RESULT_BIN_DICTIONARY_TARGETS,
+   RESULT_BIN_DICTIONARY_INTERNALFORMATS,
+   /* Enums returned by the queries, sorted by value */
+   RESULT_BIN_DICTIONARY_VALUE_ENUMS,
+   RESULT_BIN_DICTIONARY_COUNT,
+};
+
+typedef struct _result_bin result_bin;
+
+result_bin* result_bin_open(const char *path);
+
+void result_bin_clear(result_bin **bin);
+
+const char* result_bin_get_fingerprint(const result_bin *bin);
+
+const result_bin_columns* result_bin_get_columns(const result_bin *bin);
+
+unsigned result_bin_get_dictionary_size(const result_bin *bin,
+                                        enum result_bin_dictionary dictionary);
+
+GLenum result_bin_get_enum(const result_bin *bin,
+                           enum result_bin_dictionary dictionary,
+                           unsigned index);
+
+const char* result_bin_get_enum_name(const result_bin *bin,
+                                     enum result_bin_dictionary dictionary,
+                                     unsigned index);
+
+void result_bin_get_result(const result_bin *bin,
+                           uint32_t row,
+                           query_result *result);
+
+typedef struct _result_bin_writer result_bin_writer;
+
+result_bin_writer* result_bin_writer_new(const char *fingerprint,
+                                         const GLenum *pnames,
+                                         unsigned num_pnames,
+                                         const GLenum *targets,
+                                         unsigned num_targets,
+                                         const GLenum *internalformats,
+                                         unsigned num_internalformats);
+
+void result_bin_writer_add(result_bin_writer *writer,
+                           const query_result *result);
+
+bool result_bin_writer_finish(result_bin_writer **writer,
+                              output_buffer *out);
+
+#endif /* RESULTS_BIN_H */
@@ -0,0 +1,220 @@
+/*
+ * Copyright © 2016 Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+#include "ring.h"
+
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Size of a cache line, to keep the indices of each side apart */
+#define CACHE_LINE_SIZE 64
+
+/* Number of checks before yielding the CPU while waiting */
+#define SPIN_COUNT 256
+
+struct _spsc_ring {
+   size_t item_size;
+   /* Always a power of two */
+   unsigned capacity;
+   char *items;
+
+   /* Written only by the producer. @cached_tail is the last value of
+    * @tail it has seen, so it only reads it when the ring looks full */
+   _Alignas(CACHE_LINE_SIZE) atomic_uint head;
+   unsigned cached_tail;
+   atomic_bool closed;
+
+   /* Written only by the consumer, with the same for @cached_head */
+   _Alignas(CACHE_LINE_SIZE) atomic_uint tail;
+   unsigned cached_head;
+};
+
+/*
+ * Creates a ring with room for at least @capacity items of @item_size
+ * bytes.
+ */
+spsc_ring*
+spsc_ring_new(size_t item_size,
+              unsigned capacity)
+{
+   spsc_ring *result;
+   unsigned size = 1;
+
+   while (size < capacity)
+      size *= 2;
+
+   result = (spsc_ring*) aligned_alloc(CACHE_LINE_SIZE, sizeof(spsc_ring));
+   memset(result, 0, sizeof(spsc_ring));
+   result->item_size = item_size;
+   result->capacity = size;
+   result->items = (char*) malloc(item_size * size);
+   atomic_init(&result->head, 0);
+   atomic_init(&result->tail, 0);
+   atomic_init(&result->closed, false);
+
+   return result;
+}
+
+/*
+ * Frees @ring, and sets its value to NULL. Both sides must be done
+ * with it.
+ */
+void
+spsc_ring_clear(spsc_ring **ring)
+{
+   if (*ring == NULL)
+      return;
+
+   free((*ring)->items);
+   free(*ring);
+   *ring = NULL;
+}
+
+static void
+wait_a_bit(unsigned *spins)
+{
+   if (++(*spins) < SPIN_COUNT)
+      return;
+
+   *spins = 0;
+   sched_yield();
+}
+
+/*
+ * Returns the next free slot of the ring, waiting for the consumer if
+ * it is full. It is not seen by the consumer until spsc_ring_commit is
+ * called. Only to be called from the producer thread.
+ */
+void*
+spsc_ring_reserve(spsc_ring *ring)
+{
+   unsigned head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+   unsigned spins = 0;
+
+   while (head - ring->cached_tail == ring->capacity) {
+      ring->cached_tail = atomic_load_explicit(&ring->tail,
+                                               memory_order_acquire);
+      if (head - ring->cached_tail == ring->capacity)
+         wait_a_bit(&spins);
+   }
+
+   return ring->items + (head & (ring->capacity - 1)) * ring->item_size;
+}
+
+/*
+ * Passes to the consumer the slot returned by spsc_ring_reserve.
+ */
+void
+spsc_ring_commit(spsc_ring *ring)
+{
+   unsigned head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+
+   atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+}
+
+/*
+ * Tells the consumer that there will be no more items. Only to be
+ * called from the producer thread.
+ */
+void
+spsc_ring_close(spsc_ring *ring)
+{
+   atomic_store_explicit(&ring->closed, true, memory_order_release);
+}
+
+/*
+ * Returns the oldest item of the ring, waiting for the producer if it
+ * is empty, or NULL if it is empty and closed. The item stays valid
+ * until spsc_ring_release is called. Only to be called from the
+ * consumer thread.
+ */
+const void*
+spsc_ring_acquire(spsc_ring *ring)
+{
+   unsigned tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+   unsigned spins = 0;
+
+   while (tail == ring->cached_head) {
+      /* Checked before reloading head, so any item committed before
+       * closing the ring is seen */
+      bool closed = atomic_load_explicit(&ring->closed, memory_order_acquire);
+
+      ring->cached_head = atomic_load_explicit(&ring->head,
+                                               memory_order_acquire);
+      if (tail != ring->cached_head)
+         break;
+      if (closed)
+         return NULL;
+
+      wait_a_bit(&spins);
+   }
+
+   return ring->items + (tail & (ring->capacity - 1)) * ring->item_size;
+}
+
+/*
+ * Same as spsc_ring_acquire, but returns NULL right away if the ring
+ * is empty, for consumers that drain more than one ring.
+ */
+const void*
+spsc_ring_try_acquire(spsc_ring *ring)
+{
+   unsigned tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+
+   if (tail == ring->cached_head) {
+      ring->cached_head = atomic_load_explicit(&ring->head,
+                                               memory_order_acquire);
+      if (tail == ring->cached_head)
+         return NULL;
+   }
+
+   return ring->items + (tail & (ring->capacity - 1)) * ring->item_size;
+}
+
+/*
+ * Gives back to the producer the slot returned by spsc_ring_acquire
+ * or spsc_ring_try_acquire.
+ */
+void
+spsc_ring_release(spsc_ring *ring)
+{
+   unsigned tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+
+   atomic_store_explicit(&ring->tail, tail + 1, memory_order_release);
+}
+
+/*
+ * Returns the number of items committed and not released yet. It can
+ * be called from any thread, but it is only a snapshot, for
+ * statistics.
+ */
+unsigned
+spsc_ring_count(spsc_ring *ring)
+{
+   unsigned tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+   unsigned head = atomic_load_explicit(&ring->head, memory_order_acquire);
+
+   return head - tail;
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright © 2016 Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+#ifndef RING_H
+#define RING_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/* Lock-free ring buffer of fixed-size items, with one producer thread
+ * and one consumer thread. The items are written and read in place:
+ * the producer reserves a slot, fills it and commits it, and the
+ * consumer acquires it and releases it once done with it. The
+ * producer waits while the ring is full,
+ * and the consumer while it is empty, spinning for a while and then
+ * yielding the CPU, so it doesn't need any lock or syscall while both
+ * sides keep going. */
+typedef struct _spsc_ring spsc_ring;
+
+spsc_ring* spsc_ring_new(size_t item_size,
+                         unsigned capacity);
+
+void spsc_ring_clear(spsc_ring **ring);
+
+void* spsc_ring_reserve(spsc_ring *ring);
+
+void spsc_ring_commit(spsc_ring *ring);
+
+void spsc_ring_close(spsc_ring *ring);
+
+const void* spsc_ring_acquire(spsc_ring *ring);
+
+const void* spsc_ring_try_acquire(spsc_ring *ring);
+
+void spsc_ring_release(spsc_ring *ring);
+
+unsigned spsc_ring_count(spsc_ring *ring);
+
+#endif /* RING_H */
@@ -0,0 +1,186 @@
+/*
+ * Copyright © 2016 Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+/**
+ * Results fully determined by GL_ARB_internalformat_query2, from the
+ * support of the target/internalformat (GL_INTERNALFORMAT_SUPPORTED)
+ * and static properties of the targets and internalformats:
+ *
+ *  - For unsupported target/internalformat pairs, all the pnames
+ *    return 0 (so GL_FALSE or GL_NONE), but GL_SAMPLES, that doesn't
+ *    write anything, as GL_NUM_SAMPLE_COUNTS is 0.
+ *  - GL_TEXTURE_COMPRESSED is GL_FALSE, and the size of the compressed
+ *    blocks is 0, for the internalformats that are not compressed.
+ *  - GL_MAX_HEIGHT is 0 for the targets with one dimension,
+ *    GL_MAX_DEPTH for the ones without a depth, and GL_MAX_LAYERS for
+ *    the ones that are not arrays.
+ *
+ * Only the rules that all the drivers seen so far follow are here. For
+ * example, some drivers return the number of layers as GL_MAX_DEPTH of
+ * the 2D arrays, so that one is not derived. query2-info
+ * --verify-rules checks them with a driver.
+ */
+#include "spec-rules.h"
+
+#include <string.h>
+
+/* What the sweep reads when the driver doesn't write anything, see
+ * query_result_execute64 */
+#define UNWRITTEN_VALUE -1
+
+#define ARRAY_SIZE(x) (sizeof(x) / sizeof(x[0]))
+
+/* The compressed internalformats of util.h, including the generic
+ * ones, as the driver can choose a compressed format for them */
+static const GLenum compressed_internalformats[] = {
+   GL_COMPRESSED_RED,
+   GL_COMPRESSED_RG,
+   GL_COMPRESSED_RGB,
+   GL_COMPRESSED_RGBA,
+   GL_COMPRESSED_SRGB,
+   GL_COMPRESSED_SRGB_ALPHA,
+   GL_COMPRESSED_RED_RGTC1,
+   GL_COMPRESSED_SIGNED_RED_RGTC1,
+   GL_COMPRESSED_RG_RGTC2,
+   GL_COMPRESSED_SIGNED_RG_RGTC2,
+   GL_COMPRESSED_RGBA_BPTC_UNORM,
+   GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM,
+   GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT,
+   GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT,
+};
+
+static bool
+is_compressed(GLenum internalformat)
+{
+   unsigned i;
+
+   for (i = 0; i < ARRAY_SIZE(compressed_internalformats); i++) {
+      if (compressed_internalformats[i] == internalformat)
+         return true;
+   }
+
+   return false;
+}
+
+static bool
+has_height(GLenum target)
+{
+   return target != GL_TEXTURE_1D && target != GL_TEXTURE_BUFFER;
+}
+
+static bool
+has_depth(GLenum target)
+{
+   switch (target) {
+   case GL_TEXTURE_2D_ARRAY:
+   case GL_TEXTURE_2D_MULTISAMPLE_ARRAY:
+   case GL_TEXTURE_3D:
+   case GL_TEXTURE_CUBE_MAP_ARRAY:
+      return true;
+   default:
+      return false;
+   }
+}
+
+static bool
+is_array(GLenum target)
+{
+   switch (target) {
+   case GL_TEXTURE_1D_ARRAY:
+   case GL_TEXTURE_2D_ARRAY:
+   case GL_TEXTURE_2D_MULTISAMPLE_ARRAY:
+   case GL_TEXTURE_CUBE_MAP_ARRAY:
+      return true;
+   default:
+      return false;
+   }
+}
+
+/* Returns true, setting @value, if the rules determine the result of
+ * @pname */
+static bool
+derive_value(GLenum pname,
+             GLenum target,
+             GLenum internalformat,
+             bool supported,
+             GLint64 *value)
+{
+   if (pname == GL_INTERNALFORMAT_SUPPORTED) {
+      *value = supported ? GL_TRUE : GL_FALSE;
+      return true;
+   }
+
+   if (!supported) {
+      *value = pname == GL_SAMPLES ? UNWRITTEN_VALUE : 0;
+      return true;
+   }
+
+   switch (pname) {
+   case GL_TEXTURE_COMPRESSED:
+   case GL_TEXTURE_COMPRESSED_BLOCK_WIDTH:
+   case GL_TEXTURE_COMPRESSED_BLOCK_HEIGHT:
+   case GL_TEXTURE_COMPRESSED_BLOCK_SIZE:
+      *value = 0;
+      return !is_compressed(internalformat);
+   case GL_MAX_HEIGHT:
+      *value = 0;
+      return !has_height(target);
+   case GL_MAX_DEPTH:
+      *value = 0;
+      return !has_depth(target);
+   case GL_MAX_LAYERS:
+      *value = 0;
+      return !is_array(target);
+   default:
+      return false;
+   }
+}
+
+/*
+ * Fills @result with the outcome of querying the pname of @descriptor
+ * for @target and @internalformat, if the rules determine it, knowing
+ * if the pair is @supported. Only the width (testing64) is left for
+ * the caller. Returns false if it has to be queried.
+ */
+bool
+spec_rules_derive(const pname_descriptor *descriptor,
+                  GLenum target,
+                  GLenum internalformat,
+                  bool supported,
+                  query_result *result)
+{
+   GLint64 value;
+
+   if (!derive_value(descriptor->pname, target, internalformat, supported,
+                     &value))
+      return false;
+
+   result->descriptor = descriptor;
+   result->pname = descriptor->pname;
+   result->target = target;
+   result->internalformat = internalformat;
+   result->num_values = 1;
+   result->values[0] = value;
+
+   return true;
+}
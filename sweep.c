@@ -0,0 +1,666 @@
+/*
+ * Copyright © 2016 Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+/**
+ * The sweep over the pname/width/target/internalformat space.
+ *
+ * The space is split in chunks, each one being all the internalformats
+ * of a given pname/target, numbered following the order of the output.
+ * When both widths are queried, each chunk runs the 32 and 64-bit
+ * queries of each internalformat back to back, using one test_data per
+ * width, and the results are reordered when written, as the output has
+ * all the 32-bit results of a pname before the 64-bit ones.
+ *
+ * The serial sweep just runs the chunks in order on the current
+ * context. Optionally, the results are passed through a lock-free
+ * ring to an output thread, that calls the sweep callbacks, so the
+ * formatting and writing of the results overlaps with the queries.
+ * The parallel one has a pool of worker threads, each one with its own
+ * context, taking chunks from a shared queue, and the calling thread
+ * passes the results of each pname, in order, to the sweep callbacks
+ * as soon as they are available.
+ *
+ * With rules_support, the cells determined by the spec rules are
+ * filled by them instead of queried, or, when verifying them, queried
+ * and passed with the derived result to the rule callback.
+ *
+ * With a profile, each query is timed on its own, around the GL call,
+ * so the error tracking and the bookkeeping of the sweep are left out.
+ *
+ * Each chunk, the writing of each pname and, on the parallel sweep,
+ * the waits for the chunks of the next one are spans of the timeline
+ * (see timeline.c), and the chunks ahead of the writer, or the records
+ * on the ring of the output thread, its queue depth counter.
+ */
+#include "sweep.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "error-tracking.h"
+#include "ring.h"
+#include "spec-rules.h"
+#include "timeline.h"
+#include "util-string.h"
+
+/* How many chunks each worker can go ahead of the one being written,
+ * to bound the memory used for results waiting to be written */
+#define CHUNKS_AHEAD_PER_THREAD 16
+
+/* Number of records of the ring used to pass the results to the output
+ * thread */
+#define OUTPUT_RING_SIZE 1024
+
+typedef struct _sweep_chunk {
+   /* Results of each width, one after the other, each one with room
+    * for all the internalformats */
+   query_result *results;
+   /* Number of results of each width */
+   unsigned num_results;
+   /* Only when verifying the rules, the result derived by them for
+    * each result, or one without values if not determined by them */
+   query_result *derived;
+   bool done;
+} sweep_chunk;
+
+typedef struct _sweep_queue {
+   const sweep_params *params;
+   sweep_chunk *chunks;
+   unsigned num_chunks;
+   unsigned max_ahead;
+
+   pthread_mutex_t mutex;
+   /* Signaled by the workers each time a chunk is done */
+   pthread_cond_t chunk_done;
+   /* Signaled by the writer each time a pname is written */
+   pthread_cond_t chunk_written;
+   /* Next chunk to be taken by a worker */
+   unsigned next_chunk;
+   /* First chunk not written yet */
+   unsigned next_written;
+} sweep_queue;
+
+typedef struct _sweep_worker {
+   sweep_queue *queue;
+   context *ctx;
+   /* Only to name its thread */
+   unsigned number;
+   pthread_t thread;
+} sweep_worker;
+
+/* What a record passed to the output thread is. Each mismatch between
+ * widths is passed as two records, the 32-bit result followed by the
+ * 64-bit one, and each rule check as the queried result followed by
+ * the derived one. */
+enum sweep_record_kind {
+   SWEEP_RECORD_RESULT,
+   SWEEP_RECORD_MISMATCH,
+   SWEEP_RECORD_RULE_CHECK,
+};
+
+typedef struct _sweep_record {
+   enum sweep_record_kind kind;
+   query_result result;
+} sweep_record;
+
+/* State of each thread running queries */
+typedef struct _sweep_executor {
+   /* Storage for the queries of each width */
+   GLint params32[QUERY_RESULT_MAX_VALUES] __attribute__((aligned(64)));
+   GLint64 params64[QUERY_RESULT_MAX_VALUES] __attribute__((aligned(64)));
+   value_count_cache *value_counts;
+} sweep_executor;
+
+static unsigned
+num_widths(const sweep_params *params)
+{
+   return 2 - params->first_testing64;
+}
+
+static unsigned
+num_chunks(const sweep_params *params)
+{
+   return params->num_pnames * params->num_targets;
+}
+
+static void
+sweep_chunk_alloc(const sweep_params *params,
+                  sweep_chunk *chunk)
+{
+   chunk->results = (query_result*)
+      malloc(num_widths(params) * params->num_internalformats *
+             sizeof(query_result));
+   chunk->num_results = 0;
+   chunk->derived = NULL;
+   if (params->rules_support != NULL && params->rule_callback != NULL)
+      chunk->derived = (query_result*)
+         malloc(params->num_internalformats * sizeof(query_result));
+   chunk->done = false;
+}
+
+static void
+sweep_chunk_free(sweep_chunk *chunk)
+{
+   free(chunk->results);
+   free(chunk->derived);
+   chunk->results = NULL;
+   chunk->derived = NULL;
+}
+
+static bool
+results_equal(const query_result *a,
+              const query_result *b)
+{
+   return a->num_values == b->num_values &&
+      memcmp(a->values, b->values, a->num_values * sizeof(GLint64)) == 0;
+}
+
+/* Copies @src to @dst, skipping the unused values */
+static void
+copy_result(query_result *dst,
+            const query_result *src)
+{
+   dst->descriptor = src->descriptor;
+   dst->pname = src->pname;
+   dst->target = src->target;
+   dst->internalformat = src->internalformat;
+   dst->testing64 = src->testing64;
+   dst->num_values = src->num_values;
+   memcpy(dst->values, src->values, src->num_values * sizeof(GLint64));
+}
+
+/*
+ * Sets up @executor to run the queries of @params on the current
+ * thread. Note that the GL entry points used by the queries were
+ * already loaded by glewInit on the main context. All the contexts
+ * come from the same driver, so they are valid for any of them.
+ */
+static void
+sweep_executor_init(const sweep_params *params,
+                    sweep_executor *executor)
+{
+   memset(executor->params32, 0, sizeof(executor->params32));
+   memset(executor->params64, 0, sizeof(executor->params64));
+   executor->value_counts = value_count_cache_new(params->num_targets,
+                                                  params->num_internalformats);
+}
+
+static void
+sweep_executor_fini(sweep_executor *executor)
+{
+   value_count_cache_clear(&executor->value_counts);
+}
+
+/*
+ * Runs all the queries for the chunk @index, so for a given
+ * pname/target, storing the results on @chunk.
+ */
+static void
+sweep_chunk_run(const sweep_params *params,
+                unsigned index,
+                sweep_executor *executor,
+                sweep_chunk *chunk)
+{
+   unsigned target_index = index % params->num_targets;
+   unsigned pname_index = index / params->num_targets;
+   const GLenum pname = params->pnames[pname_index];
+   /* Resolved once for all the queries of the chunk */
+   const pname_descriptor *descriptor = pname_descriptor_get(pname);
+   const GLenum target = params->targets[target_index];
+   unsigned widths = num_widths(params);
+   /* Position of the first query of the chunk on the full sweep */
+   unsigned first_cell = index * params->num_internalformats * widths;
+   /* The 64-bit results are always the last ones */
+   query_result *results32 = chunk->results;
+   query_result *results64 =
+      &chunk->results[(widths - 1) * params->num_internalformats];
+   unsigned num_results = 0;
+   uint64_t start = timeline_begin();
+   unsigned j;
+
+   error_tracking_begin_chunk(first_cell, pname, target);
+
+   for (j = 0; j < params->num_internalformats; j++) {
+      const GLenum internalformat = params->internalformats[j];
+      unsigned cell = first_cell + j * widths;
+      uint64_t start;
+      int num_values;
+
+      if (params->supported != NULL &&
+          !support_matrix_is_supported(params->supported, target_index, j))
+         continue;
+
+      if (params->rules_support != NULL) {
+         bool supported =
+            support_matrix_is_supported(params->rules_support, target_index, j);
+         query_result *derived = chunk->derived != NULL ?
+            &chunk->derived[num_results] : &results64[num_results];
+
+         if (!spec_rules_derive(descriptor, target, internalformat,
+                                supported, derived)) {
+            derived->num_values = 0;
+         } else if (chunk->derived == NULL) {
+            derived->testing64 = 1;
+            if (widths == 2) {
+               copy_result(&results32[num_results], derived);
+               results32[num_results].testing64 = 0;
+            }
+            num_results++;
+            continue;
+         }
+      }
+
+      error_tracking_set_cell(cell, internalformat, params->first_testing64);
+      num_values = value_count_cache_get(executor->value_counts, descriptor,
+                                         target_index, j,
+                                         target, internalformat);
+
+      /* The widths are unrolled, so each one runs its own query
+       * without checking the width per cell */
+      if (widths == 2) {
+         start = params->profile != NULL ? profile_now() : 0;
+         query_result_execute32(executor->params32, descriptor,
+                                target, internalformat, num_values,
+                                &results32[num_results]);
+         if (params->profile != NULL)
+            profile_add(params->profile, cell, profile_now() - start);
+         error_tracking_check_cell();
+
+         error_tracking_set_cell(cell + 1, internalformat, 1);
+      }
+
+      start = params->profile != NULL ? profile_now() : 0;
+      query_result_execute64(executor->params64, descriptor,
+                             target, internalformat, num_values,
+                             &results64[num_results]);
+      if (params->profile != NULL)
+         profile_add(params->profile, cell + widths - 1,
+                     profile_now() - start);
+      error_tracking_check_cell();
+
+      num_results++;
+   }
+
+   error_tracking_end_chunk();
+
+   chunk->num_results = num_results;
+
+   timeline_span(start, "sweep", util_get_gl_enum_name(pname), "target",
+                 util_get_gl_enum_name(target));
+}
+
+static void
+push_record(spsc_ring *ring,
+            enum sweep_record_kind kind,
+            const query_result *result)
+{
+   sweep_record *record = (sweep_record*) spsc_ring_reserve(ring);
+
+   record->kind = kind;
+   copy_result(&record->result, result);
+   spsc_ring_commit(ring);
+}
+
+static void
+emit_result(const sweep_params *params,
+            spsc_ring *ring,
+            const query_result *result)
+{
+   if (ring != NULL)
+      push_record(ring, SWEEP_RECORD_RESULT, result);
+   else
+      params->callback(result, params->user_data);
+}
+
+static void
+call_pair_callback(const sweep_params *params,
+                   enum sweep_record_kind kind,
+                   const query_result *first,
+                   const query_result *second)
+{
+   if (kind == SWEEP_RECORD_MISMATCH)
+      params->mismatch_callback(first, second, params->user_data);
+   else
+      params->rule_callback(first, second, params->user_data);
+}
+
+/* Passes a width mismatch or a rule check, made of two results */
+static void
+emit_pair(const sweep_params *params,
+          spsc_ring *ring,
+          enum sweep_record_kind kind,
+          const query_result *first,
+          const query_result *second)
+{
+   if (ring != NULL) {
+      push_record(ring, kind, first);
+      push_record(ring, kind, second);
+   } else {
+      call_pair_callback(params, kind, first, second);
+   }
+}
+
+/*
+ * Passes to the sweep callbacks the results of @chunks, being the ones
+ * of all the targets of a pname. All the 32-bit results go first. If
+ * @ring is not NULL, they are passed through it to the output thread.
+ */
+static void
+sweep_emit_pname(const sweep_params *params,
+                 spsc_ring *ring,
+                 const sweep_chunk *chunks)
+{
+   unsigned widths = num_widths(params);
+   unsigned t;
+   unsigned w;
+   unsigned i;
+
+   for (w = 0; w < widths; w++) {
+      for (t = 0; t < params->num_targets; t++) {
+         const query_result *results =
+            &chunks[t].results[w * params->num_internalformats];
+
+         for (i = 0; i < chunks[t].num_results; i++)
+            emit_result(params, ring, &results[i]);
+      }
+   }
+
+   if (widths == 2 && params->mismatch_callback != NULL) {
+      for (t = 0; t < params->num_targets; t++) {
+         const query_result *results32 = chunks[t].results;
+         const query_result *results64 =
+            &chunks[t].results[params->num_internalformats];
+
+         for (i = 0; i < chunks[t].num_results; i++) {
+            if (!results_equal(&results32[i], &results64[i]))
+               emit_pair(params, ring, SWEEP_RECORD_MISMATCH,
+                         &results32[i], &results64[i]);
+         }
+      }
+   }
+
+   if (params->rules_support == NULL || params->rule_callback == NULL)
+      return;
+
+   for (w = 0; w < widths; w++) {
+      for (t = 0; t < params->num_targets; t++) {
+         const query_result *results =
+            &chunks[t].results[w * params->num_internalformats];
+
+         for (i = 0; i < chunks[t].num_results; i++) {
+            query_result *derived = &chunks[t].derived[i];
+
+            if (derived->num_values == 0)
+               continue;
+
+            derived->testing64 = results[i].testing64;
+            emit_pair(params, ring, SWEEP_RECORD_RULE_CHECK, &results[i],
+                      derived);
+         }
+      }
+   }
+}
+
+typedef struct _sweep_output {
+   const sweep_params *params;
+   spsc_ring *ring;
+   pthread_t thread;
+} sweep_output;
+
+static void*
+sweep_output_run(void *user_data)
+{
+   sweep_output *output = (sweep_output*) user_data;
+   const sweep_params *params = output->params;
+   const sweep_record *record;
+   query_result first;
+   bool have_first = false;
+
+   timeline_name_thread("output");
+
+   while ((record = spsc_ring_acquire(output->ring)) != NULL) {
+      if (record->kind == SWEEP_RECORD_RESULT) {
+         params->callback(&record->result, params->user_data);
+      } else if (!have_first) {
+         copy_result(&first, &record->result);
+         have_first = true;
+      } else {
+         call_pair_callback(params, record->kind, &first, &record->result);
+         have_first = false;
+      }
+
+      spsc_ring_release(output->ring);
+   }
+
+   return NULL;
+}
+
+/*
+ * Runs the full sweep on the current thread and context.
+ */
+void
+sweep_run(const sweep_params *params)
+{
+   sweep_executor executor;
+   sweep_output output;
+   sweep_chunk *chunks;
+   unsigned p;
+   unsigned t;
+
+   sweep_executor_init(params, &executor);
+
+   output.params = params;
+   output.ring = NULL;
+   if (params->output_thread) {
+      output.ring = spsc_ring_new(sizeof(sweep_record), OUTPUT_RING_SIZE);
+      pthread_create(&output.thread, NULL, sweep_output_run, &output);
+   }
+
+   chunks = (sweep_chunk*) calloc(params->num_targets, sizeof(sweep_chunk));
+   for (t = 0; t < params->num_targets; t++)
+      sweep_chunk_alloc(params, &chunks[t]);
+
+   for (p = 0; p < params->num_pnames; p++) {
+      uint64_t start;
+
+      for (t = 0; t < params->num_targets; t++)
+         sweep_chunk_run(params, p * params->num_targets + t, &executor,
+                         &chunks[t]);
+
+      start = timeline_begin();
+      sweep_emit_pname(params, output.ring, chunks);
+      timeline_span(start, "output", "emit", "pname",
+                    util_get_gl_enum_name(params->pnames[p]));
+      if (output.ring != NULL)
+         timeline_counter("queue depth", "records",
+                          spsc_ring_count(output.ring));
+   }
+
+   if (output.ring != NULL) {
+      spsc_ring_close(output.ring);
+      pthread_join(output.thread, NULL);
+      spsc_ring_clear(&output.ring);
+   }
+
+   for (t = 0; t < params->num_targets; t++)
+      sweep_chunk_free(&chunks[t]);
+   free(chunks);
+
+   sweep_executor_fini(&executor);
+}
+
+static void*
+sweep_worker_run(void *user_data)
+{
+   sweep_worker *worker = (sweep_worker*) user_data;
+   sweep_queue *queue = worker->queue;
+   sweep_executor executor;
+   char name[32];
+
+   snprintf(name, sizeof(name), "worker %u", worker->number);
+   timeline_name_thread(name);
+
+   if (!context_make_current(worker->ctx)) {
+      fprintf(stderr, "Error making current the context of a worker.\n");
+      exit(1);
+   }
+   error_tracking_init_context();
+
+   sweep_executor_init(queue->params, &executor);
+
+   while (true) {
+      sweep_chunk *chunk;
+      unsigned index;
+
+      pthread_mutex_lock(&queue->mutex);
+      while (queue->next_chunk < queue->num_chunks &&
+             queue->next_chunk >= queue->next_written + queue->max_ahead)
+         pthread_cond_wait(&queue->chunk_written, &queue->mutex);
+
+      if (queue->next_chunk >= queue->num_chunks) {
+         pthread_mutex_unlock(&queue->mutex);
+         break;
+      }
+      index = queue->next_chunk++;
+      timeline_counter("queue depth", "chunks",
+                       queue->next_chunk - queue->next_written);
+      pthread_mutex_unlock(&queue->mutex);
+
+      chunk = &queue->chunks[index];
+      sweep_chunk_alloc(queue->params, chunk);
+      sweep_chunk_run(queue->params, index, &executor, chunk);
+
+      pthread_mutex_lock(&queue->mutex);
+      chunk->done = true;
+      pthread_cond_broadcast(&queue->chunk_done);
+      pthread_mutex_unlock(&queue->mutex);
+   }
+
+   sweep_executor_fini(&executor);
+   context_release_current(worker->ctx);
+
+   return NULL;
+}
+
+/*
+ * Runs the full sweep using @num_threads worker threads, each one with
+ * its own context created from @ctx. The output is the same, and in
+ * the same order, as the one of sweep_run. Returns false, without
+ * running any query, if it was not possible to create the contexts for
+ * the workers or to allocate them.
+ */
+bool
+sweep_run_parallel(const sweep_params *params,
+                   const context *ctx,
+                   unsigned num_threads)
+{
+   sweep_queue queue;
+   sweep_worker *workers;
+   unsigned i;
+   unsigned j;
+   unsigned t;
+
+   workers = (sweep_worker*) calloc(num_threads, sizeof(sweep_worker));
+   if (workers == NULL)
+      return false;
+
+   for (i = 0; i < num_threads; i++) {
+      workers[i].queue = &queue;
+      workers[i].number = i + 1;
+      workers[i].ctx = context_new_sibling(ctx);
+
+      if (workers[i].ctx == NULL) {
+         while (i-- > 0)
+            context_clear(&workers[i].ctx);
+         free(workers);
+         return false;
+      }
+   }
+
+   queue.params = params;
+   queue.num_chunks = num_chunks(params);
+   queue.chunks = (sweep_chunk*) calloc(queue.num_chunks, sizeof(sweep_chunk));
+   if (queue.chunks == NULL) {
+      for (i = 0; i < num_threads; i++)
+         context_clear(&workers[i].ctx);
+      free(workers);
+      return false;
+   }
+
+   /* The chunks are written a pname at a time, so the workers must be
+    * able to go ahead at least all the targets of one */
+   queue.max_ahead = num_threads * CHUNKS_AHEAD_PER_THREAD;
+   if (queue.max_ahead < params->num_targets)
+      queue.max_ahead = params->num_targets;
+   queue.next_chunk = 0;
+   queue.next_written = 0;
+   pthread_mutex_init(&queue.mutex, NULL);
+   pthread_cond_init(&queue.chunk_done, NULL);
+   pthread_cond_init(&queue.chunk_written, NULL);
+
+   for (i = 0; i < num_threads; i++)
+      pthread_create(&workers[i].thread, NULL, sweep_worker_run, &workers[i]);
+
+   for (i = 0; i < queue.num_chunks; i += params->num_targets) {
+      sweep_chunk *chunks = &queue.chunks[i];
+      const char *pname_name =
+         util_get_gl_enum_name(params->pnames[i / params->num_targets]);
+      uint64_t start = timeline_begin();
+
+      pthread_mutex_lock(&queue.mutex);
+      for (j = 0; j < params->num_targets; j++) {
+         while (!chunks[j].done)
+            pthread_cond_wait(&queue.chunk_done, &queue.mutex);
+      }
+      pthread_mutex_unlock(&queue.mutex);
+      timeline_span(start, "sweep", "wait", "pname", pname_name);
+
+      start = timeline_begin();
+      sweep_emit_pname(params, NULL, chunks);
+      for (t = 0; t < params->num_targets; t++)
+         sweep_chunk_free(&chunks[t]);
+      timeline_span(start, "output", "emit", "pname", pname_name);
+
+      pthread_mutex_lock(&queue.mutex);
+      queue.next_written += params->num_targets;
+      timeline_counter("queue depth", "chunks",
+                       queue.next_chunk - queue.next_written);
+      pthread_cond_broadcast(&queue.chunk_written);
+      pthread_mutex_unlock(&queue.mutex);
+   }
+
+   for (i = 0; i < num_threads; i++) {
+      pthread_join(workers[i].thread, NULL);
+      context_clear(&workers[i].ctx);
+   }
+
+   pthread_cond_destroy(&queue.chunk_written);
+   pthread_cond_destroy(&queue.chunk_done);
+   pthread_mutex_destroy(&queue.mutex);
+   free(queue.chunks);
+   free(workers);
+
+   return true;
+}
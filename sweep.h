@@ -0,0 +1,100 @@
+/*
+ * Copyright © 2016 Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+#ifndef SWEEP_H
+#define SWEEP_H
+
+#include <GL/glew.h>
+#include <stdbool.h>
+
+#include "context.h"
+#include "profile.h"
+#include "util.h"
+
+/* Called with the outcome of each query. The calls follow the order
+ * of the sweep, and are always done from the same thread: the one that
+ * started it, even for the parallel sweep, or the output thread, if
+ * output_thread was requested for the serial one. */
+typedef void (*sweep_result_callback)(const query_result *result,
+                                      void *user_data);
+
+/* Called, when both widths are queried, for each cell where the 32 and
+ * 64-bit queries returned different values. It is called from the
+ * same thread as the result callback, after the results of the pname
+ * were passed to that one. */
+typedef void (*sweep_mismatch_callback)(const query_result *result32,
+                                        const query_result *result64,
+                                        void *user_data);
+
+/* Called, when verifying the spec rules, for each cell determined by
+ * them, with the result of the query and the one of the rules, that
+ * has the same width. It is called from the same thread as the result
+ * callback, after the results (and width mismatches) of the pname. */
+typedef void (*sweep_rule_callback)(const query_result *queried,
+                                    const query_result *derived,
+                                    void *user_data);
+
+/* Description of the pname/width/target/internalformat space to be
+ * queried. The sweep goes through it in that order, and that is also
+ * the order used for the output. */
+typedef struct _sweep_params {
+   /* All of them must be on pname-table.h */
+   const GLenum *pnames;
+   unsigned num_pnames;
+   const GLenum *targets;
+   unsigned num_targets;
+   const GLenum *internalformats;
+   unsigned num_internalformats;
+   /* First width used: 0 for both the 32 and 64-bit queries, 1 for
+    * only the 64-bit one */
+   int first_testing64;
+   /* If not NULL, the unsupported target/internalformat are skipped */
+   const support_matrix *supported;
+   /* If not NULL, the cells determined by the spec rules (see
+    * spec-rules.c), given the support of each target/internalformat
+    * on it, are not queried */
+   const support_matrix *rules_support;
+
+   sweep_result_callback callback;
+   /* Optional */
+   sweep_mismatch_callback mismatch_callback;
+   /* Optional, only with rules_support. If set, the cells determined
+    * by the rules are queried anyway, to check them */
+   sweep_rule_callback rule_callback;
+   void *user_data;
+
+   /* If true, the serial sweep calls the callbacks from an output
+    * thread, overlapping them with the queries. The parallel sweep
+    * already does that on the calling thread, so it ignores it. */
+   bool output_thread;
+
+   /* If not NULL, the latency of each query is added to it */
+   profile *profile;
+} sweep_params;
+
+void sweep_run(const sweep_params *params);
+
+bool sweep_run_parallel(const sweep_params *params,
+                        const context *ctx,
+                        unsigned num_threads);
+
+#endif /* SWEEP_H */
@@ -0,0 +1,349 @@
+/*
+ * Copyright © 2016 Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+/**
+ * Timeline of a run, as Chrome trace events.
+ *
+ * The spans (complete events) and counters are kept in memory, and
+ * written as JSON by timeline_finish, so recording them is just taking
+ * a lock to append them. The names and arguments must be static
+ * strings, like the ones of util_get_gl_enum_name, as only the
+ * pointers are kept. When no timeline was started, timeline_begin
+ * returns 0, and the rest of the functions return right away, so the
+ * instrumentation can stay on the hot paths.
+ *
+ * Each thread is identified by a sequential number, in the order they
+ * first added an event, and can be named with timeline_name_thread.
+ */
+#include "timeline.h"
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "file-io.h"
+#include "output.h"
+#include "util.h"
+
+enum timeline_phase {
+   TIMELINE_SPAN,
+   TIMELINE_COUNTER,
+   TIMELINE_THREAD_NAME,
+};
+
+typedef struct _timeline_event {
+   enum timeline_phase phase;
+   uint32_t thread;
+   uint64_t start;
+   uint64_t duration;
+   const char *category;
+   /* Allocated for the thread names */
+   const char *name;
+   /* NULL if there is no argument */
+   const char *arg_name;
+   /* NULL if the argument is @arg_int */
+   const char *arg_value;
+   int64_t arg_int;
+} timeline_event;
+
+static struct {
+   char *path;
+   uint64_t origin;
+   pthread_mutex_t mutex;
+   timeline_event *events;
+   uint32_t num_events;
+   uint32_t capacity;
+   atomic_uint num_threads;
+} timeline;
+
+static atomic_bool active = false;
+
+static __thread uint32_t thread_number = 0;
+
+/*
+ * Starts recording the events, to be written to @path by
+ * timeline_finish. The calling thread is named "main".
+ */
+bool
+timeline_start(const char *path)
+{
+   timeline.path = strdup(path);
+   timeline.origin = get_time_ns();
+   pthread_mutex_init(&timeline.mutex, NULL);
+   atomic_store(&active, true);
+
+   timeline_name_thread("main");
+
+   return true;
+}
+
+/*
+ * Returns the start of a span, to be passed to timeline_span, or 0 if
+ * there is no timeline.
+ */
+uint64_t
+timeline_begin(void)
+{
+   if (!atomic_load_explicit(&active, memory_order_relaxed))
+      return 0;
+
+   return get_time_ns();
+}
+
+static void
+add_event(const timeline_event *event)
+{
+   timeline_event *added;
+
+   if (thread_number == 0)
+      thread_number = atomic_fetch_add(&timeline.num_threads, 1) + 1;
+
+   pthread_mutex_lock(&timeline.mutex);
+
+   if (timeline.num_events == timeline.capacity) {
+      timeline.capacity = timeline.capacity ? timeline.capacity * 2 : 1024;
+      timeline.events = (timeline_event*)
+         realloc(timeline.events, timeline.capacity * sizeof(timeline_event));
+   }
+
+   added = &timeline.events[timeline.num_events++];
+   *added = *event;
+   added->thread = thread_number;
+
+   pthread_mutex_unlock(&timeline.mutex);
+}
+
+static void
+add_span(uint64_t start,
+         const char *category,
+         const char *name,
+         const char *arg_name,
+         const char *arg_value,
+         int64_t arg_int)
+{
+   timeline_event event;
+
+   if (start == 0 || !atomic_load_explicit(&active, memory_order_relaxed))
+      return;
+
+   event.phase = TIMELINE_SPAN;
+   event.start = start;
+   event.duration = get_time_ns() - start;
+   event.category = category;
+   event.name = name;
+   event.arg_name = arg_name;
+   event.arg_value = arg_value;
+   event.arg_int = arg_int;
+   add_event(&event);
+}
+
+/*
+ * Adds a span, from @start, as returned by timeline_begin, until now,
+ * on the calling thread. @arg_name can be NULL if there is no
+ * argument.
+ */
+void
+timeline_span(uint64_t start,
+              const char *category,
+              const char *name,
+              const char *arg_name,
+              const char *arg_value)
+{
+   add_span(start, category, name, arg_name, arg_value, 0);
+}
+
+/*
+ * The same as timeline_span, with an integer argument.
+ */
+void
+timeline_span_int(uint64_t start,
+                  const char *category,
+                  const char *name,
+                  const char *arg_name,
+                  int64_t arg_value)
+{
+   add_span(start, category, name, arg_name, NULL, arg_value);
+}
+
+/*
+ * Sets the @series of the counter @name to @value, from now on.
+ */
+void
+timeline_counter(const char *name,
+                 const char *series,
+                 int64_t value)
+{
+   timeline_event event;
+
+   if (!atomic_load_explicit(&active, memory_order_relaxed))
+      return;
+
+   memset(&event, 0, sizeof(event));
+   event.phase = TIMELINE_COUNTER;
+   event.start = get_time_ns();
+   event.name = name;
+   event.arg_name = series;
+   event.arg_int = value;
+   add_event(&event);
+}
+
+/*
+ * Names the calling thread. Unlike the rest of the strings, @name is
+ * copied.
+ */
+void
+timeline_name_thread(const char *name)
+{
+   timeline_event event;
+
+   if (!atomic_load_explicit(&active, memory_order_relaxed))
+      return;
+
+   memset(&event, 0, sizeof(event));
+   event.phase = TIMELINE_THREAD_NAME;
+   event.name = strdup(name);
+   add_event(&event);
+}
+
+static void
+append_string(output_buffer *out,
+              const char *str)
+{
+   output_buffer_append_char(out, '"');
+   for (; *str != '\0'; str++) {
+      if (*str == '"' || *str == '\\')
+         output_buffer_append_char(out, '\\');
+      output_buffer_append_char(out, *str);
+   }
+   output_buffer_append_char(out, '"');
+}
+
+/* Appends @ns as microseconds, the unit of the trace events */
+static void
+append_us(output_buffer *out,
+          uint64_t ns)
+{
+   char fraction[4];
+
+   output_buffer_append_int64(out, ns / 1000);
+   snprintf(fraction, sizeof(fraction), "%03u", (unsigned) (ns % 1000));
+   output_buffer_append_char(out, '.');
+   output_buffer_append(out, fraction, 3);
+}
+
+static void
+append_event(output_buffer *out,
+             const timeline_event *event,
+             int pid)
+{
+   static const char *phases[] = { "X", "C", "M" };
+
+   output_buffer_append_str(out, "{\"ph\":\"");
+   output_buffer_append_str(out, phases[event->phase]);
+   output_buffer_append_str(out, "\",\"pid\":");
+   output_buffer_append_int64(out, pid);
+   output_buffer_append_str(out, ",\"tid\":");
+   output_buffer_append_int64(out, event->thread);
+
+   if (event->phase == TIMELINE_THREAD_NAME) {
+      output_buffer_append_str(out, ",\"name\":\"thread_name\","
+                               "\"args\":{\"name\":");
+      append_string(out, event->name);
+      output_buffer_append_str(out, "}}");
+      return;
+   }
+
+   output_buffer_append_str(out, ",\"name\":");
+   append_string(out, event->name);
+   output_buffer_append_str(out, ",\"ts\":");
+   append_us(out, event->start - timeline.origin);
+   if (event->phase == TIMELINE_SPAN) {
+      output_buffer_append_str(out, ",\"dur\":");
+      append_us(out, event->duration);
+      output_buffer_append_str(out, ",\"cat\":");
+      append_string(out, event->category);
+   }
+
+   if (event->arg_name != NULL) {
+      output_buffer_append_str(out, ",\"args\":{");
+      append_string(out, event->arg_name);
+      output_buffer_append_char(out, ':');
+      if (event->arg_value != NULL)
+         append_string(out, event->arg_value);
+      else
+         output_buffer_append_int64(out, event->arg_int);
+      output_buffer_append_char(out, '}');
+   }
+   output_buffer_append_char(out, '}');
+}
+
+/*
+ * Stops recording the events, and writes them, replacing any previous
+ * file. Returns false if there was any error. All the other threads
+ * must be done adding events.
+ */
+bool
+timeline_finish(void)
+{
+   atomic_file *file;
+   output_buffer *out;
+   bool success = false;
+   int pid = getpid();
+   uint32_t i;
+
+   if (!atomic_load(&active))
+      return true;
+   atomic_store(&active, false);
+
+   file = atomic_file_new(timeline.path);
+   if (file != NULL) {
+      out = atomic_file_get_output(file);
+      output_buffer_append_str(out, "{\"displayTimeUnit\":\"ns\","
+                               "\"traceEvents\":[\n");
+      for (i = 0; i < timeline.num_events; i++) {
+         append_event(out, &timeline.events[i], pid);
+         output_buffer_append_str(out, i + 1 < timeline.num_events ?
+                                  ",\n" : "\n");
+      }
+      output_buffer_append_str(out, "]}\n");
+
+      success = atomic_file_finish(&file);
+   }
+
+   if (!success)
+      fprintf(stderr, "Error writing timeline `%s'.\n", timeline.path);
+
+   for (i = 0; i < timeline.num_events; i++) {
+      if (timeline.events[i].phase == TIMELINE_THREAD_NAME)
+         free((char*) timeline.events[i].name);
+   }
+   pthread_mutex_destroy(&timeline.mutex);
+   free(timeline.events);
+   free(timeline.path);
+   memset(&timeline, 0, sizeof(timeline));
+
+   return success;
+}
@@ -0,0 +1,57 @@
+/*
+ * Copyright © 2016 Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+#ifndef TIMELINE_H
+#define TIMELINE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Timeline of a run, written as Chrome trace events with
+ * --trace-timeline, to be seen on Perfetto or chrome://tracing. See
+ * timeline.c. */
+
+bool timeline_start(const char *path);
+
+uint64_t timeline_begin(void);
+
+void timeline_span(uint64_t start,
+                   const char *category,
+                   const char *name,
+                   const char *arg_name,
+                   const char *arg_value);
+
+void timeline_span_int(uint64_t start,
+                       const char *category,
+                       const char *name,
+                       const char *arg_name,
+                       int64_t arg_value);
+
+void timeline_counter(const char *name,
+                      const char *series,
+                      int64_t value);
+
+void timeline_name_thread(const char *name);
+
+bool timeline_finish(void);
+
+#endif /* TIMELINE_H */
@@ -0,0 +1,735 @@
+/*
+ * Copyright © 2016 Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+/**
+ * Trace of the GL queries of a run.
+ *
+ * While recording, the entry points on trace_gl are replaced by ones
+ * calling the GL ones and adding each call to the trace: its
+ * arguments, the values written by the driver, the GL error raised,
+ * if any, and how long it took. The error is taken with glGetError
+ * right after the call, and returned by the next trace_gl.get_error on
+ * the same thread, so the error tracking sees it as if the driver
+ * returned it.
+ *
+ * While replaying, they are replaced by ones answering each call from
+ * the trace, looked up by its arguments, so no context is needed, and
+ * the order of the calls doesn't need to be the same (as with --jobs).
+ * The size of the buffer is not part of the lookup, as it doesn't
+ * change the answer of the driver, only how many values fit, so the
+ * same queries done with another size (as the ones of the support of
+ * each target/internalformat, with --rules) are answered too.
+ *
+ * The values written are found filling the buffer with UNWRITTEN_VALUE
+ * before the call, keeping up to the last one the driver wrote, and
+ * restoring the ones it didn't write. So a value equal to the previous
+ * contents of the buffer is kept too, and the replay doesn't depend on
+ * the queries run before on the same buffer (as with --jobs, recorded
+ * on several buffers and replayed on one).
+ *
+ * The layout is:
+ *
+ *  - trace_header, with the offset and size of each section. All the
+ *    sections are 8 bytes aligned.
+ *  - The strings: the options key and the GL fingerprint of the run,
+ *    each one NUL terminated.
+ *  - The calls, as trace_call, in the order they were done.
+ *  - The values written by the calls, as int64_t.
+ *
+ * Everything is stored with the native endianness.
+ */
+#include "trace.h"
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "file-io.h"
+#include "output.h"
+#include "util.h"
+
+#define TRACE_MAGIC "Q2ITRACE"
+#define TRACE_VERSION 1
+
+/* The buffers are filled with it before each recorded call, so the
+ * values written by the driver are found even if they are the ones the
+ * buffer had. It fits on a GLint */
+#define UNWRITTEN_VALUE 0x51ab51ab
+
+enum trace_section {
+   SECTION_STRINGS,
+   SECTION_CALLS,
+   SECTION_VALUES,
+   SECTION_COUNT,
+};
+
+enum trace_function {
+   TRACE_GET_INTERNALFORMATIV,
+   TRACE_GET_INTERNALFORMATI64V,
+   TRACE_FUNCTION_COUNT,
+};
+
+typedef struct _trace_header {
+   char magic[8];
+   uint32_t version;
+   uint32_t num_calls;
+   uint32_t num_values;
+   /* Offsets on the strings */
+   uint32_t options;
+   uint32_t fingerprint;
+   uint32_t padding;
+   file_section sections[SECTION_COUNT];
+} trace_header;
+
+typedef struct _trace_call {
+   uint32_t target;
+   uint32_t internalformat;
+   uint32_t pname;
+   /* Index of the first value written on the values of the trace */
+   uint32_t first_value;
+   /* Saturated to UINT32_MAX */
+   uint32_t duration_ns;
+   /* Sequential number of the thread, in the order they first called */
+   uint32_t thread;
+   /* Size of the buffer passed */
+   uint16_t count;
+   /* The first GL error raised by the call, or GL_NO_ERROR */
+   uint16_t error;
+   uint8_t function;
+   uint8_t num_values;
+   uint16_t padding;
+} trace_call;
+
+/* Error raised by the last call of the thread, not returned yet */
+static __thread GLenum pending_error = GL_NO_ERROR;
+
+static void GLAPIENTRY
+gl_get_internalformativ(GLenum target,
+                        GLenum internalformat,
+                        GLenum pname,
+                        GLsizei count,
+                        GLint *params)
+{
+   glGetInternalformativ(target, internalformat, pname, count, params);
+}
+
+static void GLAPIENTRY
+gl_get_internalformati64v(GLenum target,
+                          GLenum internalformat,
+                          GLenum pname,
+                          GLsizei count,
+                          GLint64 *params)
+{
+   glGetInternalformati64v(target, internalformat, pname, count, params);
+}
+
+static GLenum GLAPIENTRY
+gl_get_error(void)
+{
+   return glGetError();
+}
+
+trace_gl_functions trace_gl = {
+   gl_get_internalformativ,
+   gl_get_internalformati64v,
+   gl_get_error,
+};
+
+static GLenum GLAPIENTRY
+pending_get_error(void)
+{
+   GLenum error = pending_error;
+
+   if (error == GL_NO_ERROR)
+      return gl_get_error();
+
+   pending_error = GL_NO_ERROR;
+   return error;
+}
+
+static void
+set_pending_error(GLenum error)
+{
+   if (pending_error == GL_NO_ERROR)
+      pending_error = error;
+}
+
+static struct {
+   char *path;
+   /* Created by trace_record_start, so an unwritable path fails before
+    * running any query */
+   atomic_file *file;
+   char *options;
+   char *fingerprint;
+   pthread_mutex_t mutex;
+   trace_call *calls;
+   uint32_t num_calls;
+   uint32_t calls_capacity;
+   int64_t *values;
+   uint32_t num_values;
+   uint32_t values_capacity;
+   atomic_uint num_threads;
+} recording;
+
+static __thread uint32_t thread_number = 0;
+
+static uint64_t
+now_ns(void)
+{
+   struct timespec ts;
+
+   clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+
+   return (uint64_t) ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+/* Adds a call, that wrote the first @num_values of @values */
+static void
+record_call(enum trace_function function,
+            GLenum target,
+            GLenum internalformat,
+            GLenum pname,
+            GLsizei count,
+            const int64_t *values,
+            unsigned num_values,
+            uint64_t duration_ns)
+{
+   GLenum error = gl_get_error();
+   trace_call *call;
+
+   /* Only the first one is kept, but the flags are reset */
+   while (gl_get_error() != GL_NO_ERROR)
+      ;
+   set_pending_error(error);
+
+   if (thread_number == 0)
+      thread_number = atomic_fetch_add(&recording.num_threads, 1) + 1;
+
+   pthread_mutex_lock(&recording.mutex);
+
+   if (recording.num_calls == recording.calls_capacity) {
+      recording.calls_capacity = recording.calls_capacity ?
+         recording.calls_capacity * 2 : 4096;
+      recording.calls = (trace_call*)
+         realloc(recording.calls,
+                 recording.calls_capacity * sizeof(trace_call));
+   }
+   while (recording.num_values + num_values > recording.values_capacity) {
+      recording.values_capacity = recording.values_capacity ?
+         recording.values_capacity * 2 : 4096;
+      recording.values = (int64_t*)
+         realloc(recording.values,
+                 recording.values_capacity * sizeof(int64_t));
+   }
+
+   call = &recording.calls[recording.num_calls++];
+   memset(call, 0, sizeof(*call));
+   call->target = target;
+   call->internalformat = internalformat;
+   call->pname = pname;
+   call->first_value = recording.num_values;
+   call->duration_ns = duration_ns < UINT32_MAX ? duration_ns : UINT32_MAX;
+   call->thread = thread_number - 1;
+   call->count = count > 0 ? (count < UINT16_MAX ? count : UINT16_MAX) : 0;
+   call->error = error;
+   call->function = function;
+   call->num_values = num_values;
+
+   memcpy(&recording.values[recording.num_values], values,
+          num_values * sizeof(int64_t));
+   recording.num_values += num_values;
+
+   pthread_mutex_unlock(&recording.mutex);
+}
+
+static unsigned
+get_num_compared(GLsizei count,
+                 const void *params)
+{
+   if (params == NULL || count <= 0)
+      return 0;
+
+   return count < QUERY_RESULT_MAX_VALUES ? count : QUERY_RESULT_MAX_VALUES;
+}
+
+/* Number of values written by the driver, of the @num_compared ones
+ * filled with UNWRITTEN_VALUE before the call. The ones after the
+ * last written are not kept, and the ones before it that were not
+ * written are kept with the previous contents of the buffer */
+static unsigned
+get_num_written(const int64_t *values,
+                unsigned num_compared)
+{
+   unsigned num_values = num_compared;
+
+   while (num_values > 0 && values[num_values - 1] == UNWRITTEN_VALUE)
+      num_values--;
+
+   return num_values;
+}
+
+static void GLAPIENTRY
+record_get_internalformativ(GLenum target,
+                            GLenum internalformat,
+                            GLenum pname,
+                            GLsizei count,
+                            GLint *params)
+{
+   unsigned num_compared = get_num_compared(count, params);
+   unsigned num_values;
+   GLint before[QUERY_RESULT_MAX_VALUES];
+   int64_t after[QUERY_RESULT_MAX_VALUES];
+   uint64_t start;
+   uint64_t end;
+   unsigned i;
+
+   for (i = 0; i < num_compared; i++) {
+      before[i] = params[i];
+      params[i] = UNWRITTEN_VALUE;
+   }
+
+   start = now_ns();
+   gl_get_internalformativ(target, internalformat, pname, count, params);
+   end = now_ns();
+
+   for (i = 0; i < num_compared; i++)
+      after[i] = params[i];
+   num_values = get_num_written(after, num_compared);
+
+   for (i = 0; i < num_compared; i++) {
+      if (after[i] == UNWRITTEN_VALUE)
+         after[i] = params[i] = before[i];
+   }
+
+   record_call(TRACE_GET_INTERNALFORMATIV, target, internalformat, pname,
+               count, after, num_values, end - start);
+}
+
+static void GLAPIENTRY
+record_get_internalformati64v(GLenum target,
+                              GLenum internalformat,
+                              GLenum pname,
+                              GLsizei count,
+                              GLint64 *params)
+{
+   unsigned num_compared = get_num_compared(count, params);
+   unsigned num_values;
+   GLint64 before[QUERY_RESULT_MAX_VALUES];
+   int64_t after[QUERY_RESULT_MAX_VALUES];
+   uint64_t start;
+   uint64_t end;
+   unsigned i;
+
+   for (i = 0; i < num_compared; i++) {
+      before[i] = params[i];
+      params[i] = UNWRITTEN_VALUE;
+   }
+
+   start = now_ns();
+   gl_get_internalformati64v(target, internalformat, pname, count, params);
+   end = now_ns();
+
+   for (i = 0; i < num_compared; i++)
+      after[i] = params[i];
+   num_values = get_num_written(after, num_compared);
+
+   for (i = 0; i < num_compared; i++) {
+      if (after[i] == UNWRITTEN_VALUE)
+         after[i] = params[i] = before[i];
+   }
+
+   record_call(TRACE_GET_INTERNALFORMATI64V, target, internalformat, pname,
+               count, after, num_values, end - start);
+}
+
+/*
+ * Starts recording the queries done through trace_gl, for a run with
+ * the @options key (as the one of the cache) on a driver with
+ * @fingerprint. Nothing is written until trace_record_finish, but the
+ * temporary file is created here. Returns false if it can't be.
+ */
+bool
+trace_record_start(const char *path,
+                   const char *options,
+                   const char *fingerprint)
+{
+   memset(&recording, 0, sizeof(recording));
+   recording.file = atomic_file_new(path);
+   if (recording.file == NULL)
+      return false;
+
+   recording.path = strdup(path);
+   recording.options = strdup(options);
+   recording.fingerprint = strdup(fingerprint);
+   pthread_mutex_init(&recording.mutex, NULL);
+
+   trace_gl.get_internalformativ = record_get_internalformativ;
+   trace_gl.get_internalformati64v = record_get_internalformati64v;
+   trace_gl.get_error = pending_get_error;
+
+   return true;
+}
+
+/*
+ * Stops the recording, restoring the GL entry points on trace_gl, and
+ * writes the trace, replacing any previous one. Returns false if
+ * there was any error.
+ */
+bool
+trace_record_finish(void)
+{
+   trace_header header;
+   const void *sections[SECTION_COUNT];
+   size_t options_size = strlen(recording.options) + 1;
+   size_t fingerprint_size = strlen(recording.fingerprint) + 1;
+   char *strings;
+   bool success;
+
+   trace_gl.get_internalformativ = gl_get_internalformativ;
+   trace_gl.get_internalformati64v = gl_get_internalformati64v;
+   trace_gl.get_error = gl_get_error;
+
+   strings = (char*) malloc(options_size + fingerprint_size);
+   memcpy(strings, recording.options, options_size);
+   memcpy(strings + options_size, recording.fingerprint, fingerprint_size);
+
+   memset(&header, 0, sizeof(header));
+   memcpy(header.magic, TRACE_MAGIC, sizeof(header.magic));
+   header.version = TRACE_VERSION;
+   header.num_calls = recording.num_calls;
+   header.num_values = recording.num_values;
+   header.options = 0;
+   header.fingerprint = options_size;
+
+   sections[SECTION_STRINGS] = strings;
+   header.sections[SECTION_STRINGS].size = options_size + fingerprint_size;
+   sections[SECTION_CALLS] = recording.calls;
+   header.sections[SECTION_CALLS].size =
+      (size_t) recording.num_calls * sizeof(trace_call);
+   sections[SECTION_VALUES] = recording.values;
+   header.sections[SECTION_VALUES].size =
+      (size_t) recording.num_values * sizeof(int64_t);
+
+   file_sections_set_offsets(header.sections, SECTION_COUNT, sizeof(header));
+   file_sections_append(atomic_file_get_output(recording.file), &header,
+                        sizeof(header), header.sections, sections,
+                        SECTION_COUNT);
+
+   success = atomic_file_finish(&recording.file);
+   if (!success)
+      fprintf(stderr, "Error writing trace `%s'.\n", recording.path);
+
+   pthread_mutex_destroy(&recording.mutex);
+   free(strings);
+   free(recording.calls);
+   free(recording.values);
+   free(recording.path);
+   free(recording.options);
+   free(recording.fingerprint);
+   memset(&recording, 0, sizeof(recording));
+
+   return success;
+}
+
+static struct {
+   const char *data;
+   size_t size;
+   const trace_header *header;
+   const char *strings;
+   const trace_call *calls;
+   const int64_t *values;
+   /* Open addressing table of indices on @calls, plus one, by their
+    * arguments. 0 is an empty slot. */
+   uint32_t *table;
+   uint32_t table_mask;
+   atomic_uint misses;
+} replay;
+
+static uint32_t
+hash_call(enum trace_function function,
+          GLenum target,
+          GLenum internalformat,
+          GLenum pname)
+{
+   uint64_t value = function;
+
+   value = value * 0x9e3779b97f4a7c15ull + target;
+   value = value * 0x9e3779b97f4a7c15ull + internalformat;
+   value = value * 0x9e3779b97f4a7c15ull + pname;
+
+   return (uint32_t) (value >> 32);
+}
+
+static bool
+call_matches(const trace_call *call,
+             enum trace_function function,
+             GLenum target,
+             GLenum internalformat,
+             GLenum pname)
+{
+   return call->function == function && call->target == target &&
+      call->internalformat == internalformat && call->pname == pname;
+}
+
+/* Returns the slot of the table for the call with those arguments,
+ * either the one with its index or the empty one where it should go */
+static uint32_t*
+find_slot(enum trace_function function,
+          GLenum target,
+          GLenum internalformat,
+          GLenum pname)
+{
+   uint32_t slot = hash_call(function, target, internalformat, pname) &
+      replay.table_mask;
+
+   while (replay.table[slot] != 0 &&
+          !call_matches(&replay.calls[replay.table[slot] - 1], function,
+                        target, internalformat, pname))
+      slot = (slot + 1) & replay.table_mask;
+
+   return &replay.table[slot];
+}
+
+/* Answers a call from the trace, returning its values, or NULL if it
+ * is not there */
+static const int64_t*
+replay_call(enum trace_function function,
+            GLenum target,
+            GLenum internalformat,
+            GLenum pname,
+            GLsizei count,
+            unsigned *num_values)
+{
+   uint32_t index = *find_slot(function, target, internalformat, pname);
+   const trace_call *call;
+
+   if (index == 0) {
+      atomic_fetch_add_explicit(&replay.misses, 1, memory_order_relaxed);
+      *num_values = 0;
+      return NULL;
+   }
+
+   call = &replay.calls[index - 1];
+   set_pending_error(call->error);
+   *num_values = call->num_values;
+   if (count <= 0)
+      *num_values = 0;
+   else if (*num_values > (unsigned) count)
+      *num_values = count;
+
+   return &replay.values[call->first_value];
+}
+
+static void GLAPIENTRY
+replay_get_internalformativ(GLenum target,
+                            GLenum internalformat,
+                            GLenum pname,
+                            GLsizei count,
+                            GLint *params)
+{
+   unsigned num_values;
+   const int64_t *values = replay_call(TRACE_GET_INTERNALFORMATIV, target,
+                                       internalformat, pname, count,
+                                       &num_values);
+   unsigned i;
+
+   for (i = 0; i < num_values; i++)
+      params[i] = values[i];
+}
+
+static void GLAPIENTRY
+replay_get_internalformati64v(GLenum target,
+                              GLenum internalformat,
+                              GLenum pname,
+                              GLsizei count,
+                              GLint64 *params)
+{
+   unsigned num_values;
+   const int64_t *values = replay_call(TRACE_GET_INTERNALFORMATI64V, target,
+                                       internalformat, pname, count,
+                                       &num_values);
+
+   memcpy(params, values, num_values * sizeof(int64_t));
+}
+
+/* As there is no context, the only errors are the ones of the trace */
+static GLenum GLAPIENTRY
+replay_get_error(void)
+{
+   GLenum error = pending_error;
+
+   pending_error = GL_NO_ERROR;
+   return error;
+}
+
+static bool
+section_is_valid(enum trace_section section,
+                 uint64_t expected_size)
+{
+   return file_section_is_valid(&replay.header->sections[section],
+                                replay.size, expected_size);
+}
+
+static const void*
+section_data(enum trace_section section)
+{
+   return file_section_data(replay.data, &replay.header->sections[section]);
+}
+
+/* Checks the header of the trace being replayed, sets up the pointers
+ * to the sections, and builds the table of calls. The references of
+ * the calls to the values are checked too. */
+static bool
+replay_init(void)
+{
+   const trace_header *header = replay.header;
+   uint64_t strings_size;
+   uint32_t table_size = 1;
+   uint32_t i;
+
+   if (replay.size < sizeof(trace_header) ||
+       memcmp(header->magic, TRACE_MAGIC, sizeof(header->magic)) != 0 ||
+       header->version != TRACE_VERSION)
+      return false;
+
+   strings_size = header->sections[SECTION_STRINGS].size;
+   if (!section_is_valid(SECTION_STRINGS, strings_size) ||
+       !section_is_valid(SECTION_CALLS,
+                         (uint64_t) header->num_calls * sizeof(trace_call)) ||
+       !section_is_valid(SECTION_VALUES,
+                         (uint64_t) header->num_values * sizeof(int64_t)))
+      return false;
+
+   replay.strings = section_data(SECTION_STRINGS);
+   replay.calls = section_data(SECTION_CALLS);
+   replay.values = section_data(SECTION_VALUES);
+
+   if (strings_size == 0 || replay.strings[strings_size - 1] != '\0' ||
+       header->options >= strings_size || header->fingerprint >= strings_size)
+      return false;
+
+   for (i = 0; i < header->num_calls; i++) {
+      const trace_call *call = &replay.calls[i];
+
+      if (call->function >= TRACE_FUNCTION_COUNT ||
+          call->num_values > QUERY_RESULT_MAX_VALUES ||
+          call->first_value > header->num_values ||
+          call->num_values > header->num_values - call->first_value)
+         return false;
+   }
+
+   /* Keeping the table at most half full */
+   while (table_size < 2 * header->num_calls)
+      table_size *= 2;
+   replay.table = (uint32_t*) calloc(table_size, sizeof(uint32_t));
+   replay.table_mask = table_size - 1;
+
+   /* The same call can be done more than once, answered by the first
+    * one */
+   for (i = 0; i < header->num_calls; i++) {
+      const trace_call *call = &replay.calls[i];
+      uint32_t *slot = find_slot(call->function, call->target,
+                                 call->internalformat, call->pname);
+
+      if (*slot == 0)
+         *slot = i + 1;
+   }
+
+   return true;
+}
+
+/*
+ * Maps the trace at @path, and replaces the entry points on trace_gl
+ * by ones answering from it. Returns false if it can't be read or it
+ * is not a valid one.
+ */
+bool
+trace_replay_start(const char *path)
+{
+   const void *data;
+   size_t size;
+
+   data = file_map(path, &size);
+   if (data == NULL)
+      return false;
+
+   replay.data = data;
+   replay.size = size;
+   replay.header = data;
+   atomic_store(&replay.misses, 0);
+
+   if (!replay_init()) {
+      trace_replay_finish();
+      return false;
+   }
+
+   trace_gl.get_internalformativ = replay_get_internalformativ;
+   trace_gl.get_internalformati64v = replay_get_internalformati64v;
+   trace_gl.get_error = replay_get_error;
+
+   return true;
+}
+
+/*
+ * Returns the options key of the run recorded on the trace being
+ * replayed.
+ */
+const char*
+trace_replay_get_options(void)
+{
+   return replay.strings + replay.header->options;
+}
+
+/*
+ * Returns the GL fingerprint of the driver of the run recorded on the
+ * trace being replayed.
+ */
+const char*
+trace_replay_get_fingerprint(void)
+{
+   return replay.strings + replay.header->fingerprint;
+}
+
+/*
+ * Stops the replay, restoring the GL entry points on trace_gl, and
+ * unmaps the trace. Returns the number of calls that were not on it.
+ */
+uint32_t
+trace_replay_finish(void)
+{
+   uint32_t misses = atomic_load(&replay.misses);
+
+   trace_gl.get_internalformativ = gl_get_internalformativ;
+   trace_gl.get_internalformati64v = gl_get_internalformati64v;
+   trace_gl.get_error = gl_get_error;
+
+   free(replay.table);
+   if (replay.data != NULL)
+      file_unmap(replay.data, replay.size);
+   memset(&replay, 0, sizeof(replay));
+
+   return misses;
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright © 2016 Intel Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <GL/glew.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Trace of the GL queries of a run, recorded with --record and
+ * replayed, without any context, with --replay. See trace.c for the
+ * layout. */
+
+/* The entry points used for the queries. They are the GL ones, unless
+ * a trace is being recorded or replayed. */
+typedef struct _trace_gl_functions {
+   void (GLAPIENTRY *get_internalformativ)(GLenum target,
+                                           GLenum internalformat,
+                                           GLenum pname,
+                                           GLsizei count,
+                                           GLint *params);
+   void (GLAPIENTRY *get_internalformati64v)(GLenum target,
+                                             GLenum internalformat,
+                                             GLenum pname,
+                                             GLsizei count,
+                                             GLint64 *params);
+   GLenum (GLAPIENTRY *get_error)(void);
+} trace_gl_functions;
+
+extern trace_gl_functions trace_gl;
+
+bool trace_record_start(const char *path,
+                        const char *options,
+                        const char *fingerprint);
+
+bool trace_record_finish(void);
+
+bool trace_replay_start(const char *path);
+
+const char* trace_replay_get_options(void);
+
+const char* trace_replay_get_fingerprint(void);
+
+uint32_t trace_replay_finish(void);
+
+#endif /* TRACE_H */
@@ -20,6 +20,19 @@
  * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
  * IN THE SOFTWARE.
  */
+#ifndef UTIL_STRING_H
+#define UTIL_STRING_H
+
 #include <GL/glew.h>
+#include <stdbool.h>
+#include <stddef.h>
 
 const char* util_get_gl_enum_name(const GLenum param);
+
+const char* util_get_gl_enum_name_with_length(const GLenum param,
+                                              size_t *length);
+
+bool util_get_gl_enum_value(const char *name,
+                            GLenum *value);
+
+#endif /* UTIL_STRING_H */
@@ -26,8 +26,11 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 
 #include <inttypes.h>  /* for PRIu64 macro */
+#include "error-tracking.h"
+#include "trace.h"
 #include "util-string.h"
 
 /* Generic callback type, doing a cast of params to void*, to avoid
@@ -47,25 +50,23 @@ struct _test_data {
     * possible values. */
    int testing64;
    int params_size;
-   void *params;
    GetInternalformat callback;
+   /* Fixed storage, big enough for any of the queries, so changing
+    * the width doesn't need to reallocate it */
+   union {
+      GLint params32[QUERY_RESULT_MAX_VALUES];
+      GLint64 params64[QUERY_RESULT_MAX_VALUES];
+   } __attribute__((aligned(64)));
 };
 
-/* Updates the callback and params based on current values of
- * testing64 and params_size */
+/* Updates the callback based on the current value of testing64 */
 static void
 sync_test_data(test_data *data)
 {
-   if (data->params != NULL)
-      free(data->params);
-
-   if (data->testing64) {
-      data->callback = (GetInternalformat) glGetInternalformati64v;
-      data->params = malloc(sizeof(GLint64) * data->params_size);
-   } else {
-      data->callback = (GetInternalformat) glGetInternalformativ;
-      data->params = malloc(sizeof(GLint) * data->params_size);
-   }
+   if (data->testing64)
+      data->callback = (GetInternalformat) trace_gl.get_internalformati64v;
+   else
+      data->callback = (GetInternalformat) trace_gl.get_internalformativ;
 }
 
 test_data*
@@ -74,10 +75,12 @@ test_data_new(int testing64,
 {
    test_data *result;
 
-   result = (test_data*) malloc(sizeof(test_data));
+   if (params_size > QUERY_RESULT_MAX_VALUES)
+      params_size = QUERY_RESULT_MAX_VALUES;
+
+   result = (test_data*) aligned_alloc(64, sizeof(test_data));
    result->testing64 = testing64;
    result->params_size = params_size;
-   result->params = NULL;
 
    sync_test_data(result);
 
@@ -95,9 +98,6 @@ test_data_clear(test_data **data)
    if (_data == NULL)
       return;
 
-   free(_data->params);
-   _data->params = NULL;
-
    free(_data);
    *data = NULL;
 }
@@ -108,8 +108,9 @@ test_data_execute(test_data *data,
                   const GLenum internalformat,
                   const GLenum pname)
 {
-   data->callback(target, internalformat, pname,
-                  data->params_size, data->params);
+   data->callback(target, internalformat, pname, data->params_size,
+                  data->testing64 ? (void*) data->params64 :
+                  (void*) data->params32);
 }
 
 void
@@ -128,16 +129,16 @@ test_data_set_value_at_index(test_data *data,
                              const int index,
                              const GLint64 value)
 {
-   if (index > data->params_size || index < 0) {
+   if (index >= data->params_size || index < 0) {
       fprintf(stderr, "ERROR: invalid index while setting"
               " auxiliar test data\n");
       return;
    }
 
    if (data->testing64) {
-      ((GLint64*)data->params)[index] = value;
+      data->params64[index] = value;
    } else {
-      ((GLint*)data->params)[index] = value;
+      data->params32[index] = value;
    }
 }
 
@@ -145,15 +146,13 @@ GLint64
 test_data_value_at_index(const test_data *data,
                          const int index)
 {
-   if (index > data->params_size || index < 0) {
+   if (index >= data->params_size || index < 0) {
       fprintf(stderr, "ERROR: invalid index while retrieving"
               " data from auxiliar test data\n");
       return -1;
    }
 
-   return data->testing64 ?
-      ((GLint64*)data->params)[index] :
-      ((GLint*)data->params)[index];
+   return data->testing64 ? data->params64[index] : data->params32[index];
 }
 
 /*
@@ -175,7 +174,7 @@ test_data_check_supported(const test_data *data,
    test_data_execute(local_data, target, internalformat,
                      GL_INTERNALFORMAT_SUPPORTED);
 
-   check_gl_error();
+   error_tracking_check_cell();
    result = test_data_value_at_index(local_data, 0) == GL_TRUE;
 
    test_data_clear(&local_data);
@@ -183,116 +182,84 @@ test_data_check_supported(const test_data *data,
    return result;
 }
 
-/* There are cases where a pname is returning an already know GL enum
- * instead of a value. */
-static bool
-pname_returns_enum(const GLenum pname)
+/* Bitmap with the outcome of INTERNALFORMAT_SUPPORTED for each
+ * target/internalformat pair, indexed by their position on the arrays
+ * used to build it. As the support doesn't depend on the pname being
+ * queried, nor on the query being the 32 or the 64-bit one, it is
+ * computed once per context and then reused for the full sweep. */
+struct _support_matrix {
+   unsigned num_targets;
+   unsigned num_internalformats;
+   uint32_t bits[];
+};
+
+support_matrix*
+support_matrix_new(const GLenum *targets,
+                   unsigned num_targets,
+                   const GLenum *internalformats,
+                   unsigned num_internalformats)
 {
-   switch (pname) {
-   case GL_NUM_SAMPLE_COUNTS:
-   case GL_SAMPLES:
-   case GL_INTERNALFORMAT_RED_SIZE:
-   case GL_INTERNALFORMAT_GREEN_SIZE:
-   case GL_INTERNALFORMAT_BLUE_SIZE:
-   case GL_INTERNALFORMAT_ALPHA_SIZE:
-   case GL_INTERNALFORMAT_DEPTH_SIZE:
-   case GL_INTERNALFORMAT_STENCIL_SIZE:
-   case GL_INTERNALFORMAT_SHARED_SIZE:
-   case GL_MAX_WIDTH:
-   case GL_MAX_HEIGHT:
-   case GL_MAX_DEPTH:
-   case GL_MAX_LAYERS:
-   case GL_MAX_COMBINED_DIMENSIONS:
-   case GL_IMAGE_TEXEL_SIZE:
-   case GL_TEXTURE_COMPRESSED_BLOCK_WIDTH:
-   case GL_TEXTURE_COMPRESSED_BLOCK_HEIGHT:
-   case GL_TEXTURE_COMPRESSED_BLOCK_SIZE:
-      return false;
-   default:
-      return true;
+   support_matrix *result;
+   test_data *local_data;
+   unsigned num_words = (num_targets * num_internalformats + 31) / 32;
+   unsigned i;
+   unsigned j;
+
+   result = (support_matrix*) calloc(1, sizeof(support_matrix) +
+                                     num_words * sizeof(uint32_t));
+   result->num_targets = num_targets;
+   result->num_internalformats = num_internalformats;
+
+   local_data = test_data_new(1, 1);
+   for (i = 0; i < num_targets; i++) {
+      error_tracking_begin_chunk(i * num_internalformats,
+                                 GL_INTERNALFORMAT_SUPPORTED, targets[i]);
+
+      for (j = 0; j < num_internalformats; j++) {
+         unsigned bit = i * num_internalformats + j;
+
+         error_tracking_set_cell(bit, internalformats[j], 1);
+         test_data_set_value_at_index(local_data, 0, GL_FALSE);
+         test_data_execute(local_data, targets[i], internalformats[j],
+                           GL_INTERNALFORMAT_SUPPORTED);
+
+         error_tracking_check_cell();
+         if (test_data_value_at_index(local_data, 0) == GL_TRUE)
+            result->bits[bit / 32] |= 1u << (bit % 32);
+      }
+
+      error_tracking_end_chunk();
    }
+   test_data_clear(&local_data);
+
+   return result;
 }
 
-/* Needed to complement _pname_returns_enum because GL_POINTS/GL_FALSE
- * and GL_LINES/GL_TRUE has the same value */
-static bool
-pname_returns_gl_boolean(const GLenum pname)
+/*
+ * Frees @matrix, and sets its value to NULL.
+ */
+void
+support_matrix_clear(support_matrix **matrix)
 {
-   switch(pname) {
-   case GL_INTERNALFORMAT_SUPPORTED:
-   case GL_COLOR_COMPONENTS:
-   case GL_DEPTH_COMPONENTS:
-   case GL_STENCIL_COMPONENTS:
-   case GL_COLOR_RENDERABLE:
-   case GL_DEPTH_RENDERABLE:
-   case GL_STENCIL_RENDERABLE:
-   case GL_MIPMAP:
-   case GL_TEXTURE_COMPRESSED:
-      return true;
-   default:
-      return false;
-   }
+   free(*matrix);
+   *matrix = NULL;
 }
 
-/* Needed because GL_NONE has the same value that GL_FALSE and GL_POINTS */
-static bool
-pname_can_return_gl_none(const GLenum pname)
+bool
+support_matrix_is_supported(const support_matrix *matrix,
+                            unsigned target_index,
+                            unsigned internalformat_index)
 {
-   switch(pname) {
-   case GL_INTERNALFORMAT_PREFERRED:
-   case GL_INTERNALFORMAT_RED_TYPE:
-   case GL_INTERNALFORMAT_GREEN_TYPE:
-   case GL_INTERNALFORMAT_BLUE_TYPE:
-   case GL_INTERNALFORMAT_ALPHA_TYPE:
-   case GL_INTERNALFORMAT_DEPTH_TYPE:
-   case GL_INTERNALFORMAT_STENCIL_TYPE:
-   case GL_FRAMEBUFFER_RENDERABLE:
-   case GL_FRAMEBUFFER_RENDERABLE_LAYERED:
-   case GL_FRAMEBUFFER_BLEND:
-   case GL_READ_PIXELS:
-   case GL_READ_PIXELS_FORMAT:
-   case GL_READ_PIXELS_TYPE:
-   case GL_TEXTURE_IMAGE_FORMAT:
-   case GL_TEXTURE_IMAGE_TYPE:
-   case GL_GET_TEXTURE_IMAGE_FORMAT:
-   case GL_GET_TEXTURE_IMAGE_TYPE:
-   case GL_MANUAL_GENERATE_MIPMAP:
-   case GL_AUTO_GENERATE_MIPMAP:
-   case GL_COLOR_ENCODING:
-   case GL_SRGB_READ:
-   case GL_SRGB_WRITE:
-   case GL_SRGB_DECODE_ARB:
-   case GL_FILTER:
-   case GL_VERTEX_TEXTURE:
-   case GL_TESS_CONTROL_TEXTURE:
-   case GL_TESS_EVALUATION_TEXTURE:
-   case GL_GEOMETRY_TEXTURE:
-   case GL_FRAGMENT_TEXTURE:
-   case GL_COMPUTE_TEXTURE:
-   case GL_TEXTURE_SHADOW:
-   case GL_TEXTURE_GATHER:
-   case GL_TEXTURE_GATHER_SHADOW:
-   case GL_SHADER_IMAGE_LOAD:
-   case GL_SHADER_IMAGE_STORE:
-   case GL_SHADER_IMAGE_ATOMIC:
-   case GL_IMAGE_COMPATIBILITY_CLASS:
-   case GL_IMAGE_PIXEL_FORMAT:
-   case GL_IMAGE_PIXEL_TYPE:
-   case GL_IMAGE_FORMAT_COMPATIBILITY_TYPE:
-   case GL_SIMULTANEOUS_TEXTURE_AND_DEPTH_TEST:
-   case GL_SIMULTANEOUS_TEXTURE_AND_STENCIL_TEST:
-   case GL_SIMULTANEOUS_TEXTURE_AND_DEPTH_WRITE:
-   case GL_SIMULTANEOUS_TEXTURE_AND_STENCIL_WRITE:
-   case GL_CLEAR_BUFFER:
-   case GL_TEXTURE_VIEW:
-   case GL_VIEW_COMPATIBILITY_CLASS:
-      return true;
-   default:
-      return false;
-   }
+   unsigned bit = target_index * matrix->num_internalformats +
+      internalformat_index;
+
+   return (matrix->bits[bit / 32] >> (bit % 32)) & 1;
 }
 
-/* wrapper for GL_SAMPLE_COUNTS */
+/* wrapper for GL_SAMPLE_COUNTS. On the batched mode the error check
+ * always passes, so a failed query is only noticed by the -1 reference
+ * value being kept, and the count is clamped to what a result can
+ * hold, treating negative ones as no values */
 static GLint64
 get_num_sample_counts(const GLenum target,
                       const GLenum internalformat)
@@ -300,84 +267,294 @@ get_num_sample_counts(const GLenum target,
    GLint64 result = -1;
    test_data *local_data = test_data_new(0, 1);
 
+   test_data_set_value_at_index(local_data, 0, -1);
    test_data_execute(local_data, target, internalformat,
                      GL_NUM_SAMPLE_COUNTS);
 
-   if (check_gl_error())
+   if (error_tracking_check_cell())
       result = -1;
    else
       result = test_data_value_at_index(local_data, 0);
 
    test_data_clear(&local_data);
 
+   if (result < 0)
+      return 0;
+   if (result > QUERY_RESULT_MAX_VALUES)
+      return QUERY_RESULT_MAX_VALUES;
    return result;
 }
 
-static const char*
-get_value_enum_name(const GLenum pname,
-                    const GLint64 value)
+static void
+append_enum_name(output_buffer *out,
+                 const GLenum value)
+{
+   size_t length;
+   const char *name = util_get_gl_enum_name_with_length(value, &length);
+
+   output_buffer_append(out, name, length);
+}
+
+static void
+append_integer_values(output_buffer *out,
+                      const query_result *result)
+{
+   int i;
+
+   for (i = 0; i < result->num_values - 1; i++) {
+      output_buffer_append_int64(out, result->values[i]);
+      output_buffer_append_char(out, ',');
+   }
+   output_buffer_append_int64(out, result->values[i]);
+}
+
+/* Needed because GL_FALSE/GL_TRUE have the same values than
+ * GL_POINTS/GL_LINES */
+static void
+append_boolean_value(output_buffer *out,
+                     const query_result *result)
+{
+   if (result->values[0])
+      output_buffer_append(out, "GL_TRUE", sizeof("GL_TRUE") - 1);
+   else
+      output_buffer_append(out, "GL_FALSE", sizeof("GL_FALSE") - 1);
+}
+
+/* Needed because GL_NONE has the same value than GL_FALSE and
+ * GL_POINTS */
+static void
+append_enum_value(output_buffer *out,
+                  const query_result *result)
 {
-   if (pname_returns_gl_boolean(pname))
-      return value ? "GL_TRUE" : "GL_FALSE";
-   else if (pname_can_return_gl_none(pname) && value == 0)
-      return "GL_NONE";
+   if (result->values[0] == 0)
+      output_buffer_append(out, "GL_NONE", sizeof("GL_NONE") - 1);
    else
-      return util_get_gl_enum_name(value);
+      append_enum_name(out, result->values[0]);
 }
+
+#define PNAME_FORMATTER_INTEGER append_integer_values
+#define PNAME_FORMATTER_BOOLEAN append_boolean_value
+#define PNAME_FORMATTER_ENUM append_enum_value
+
+#define PNAME_TABLE_ENTRY(pname, kind, count) \
+   {                                          \
+      pname,                                  \
+      PNAME_VALUE_##kind,                     \
+      PNAME_VALUE_COUNT_##count,              \
+      PNAME_FORMATTER_##kind,                 \
+   },
+static const pname_descriptor pname_descriptors[] = {
+   PNAME_TABLE(PNAME_TABLE_ENTRY)
+};
+#undef PNAME_TABLE_ENTRY
+
 /*
- * Returns the number of values that a given pname returns. For
- * example, for the case of GL_SAMPLES, it returns as many sample
- * counts as the valure returned by GL_SAMPLE_COUNTS
+ * Returns the descriptor of @pname, or NULL if it is not one of the
+ * pnames of pname-table.h. To be called once per pname, not per query.
  */
-static unsigned
-pname_value_count(const GLenum pname,
-                  const GLenum target,
-                  const GLenum internalformat)
+const pname_descriptor*
+pname_descriptor_get(GLenum pname)
 {
-   switch (pname) {
-   case GL_SAMPLES:
-      return get_num_sample_counts(target, internalformat);
-   default:
-      return 1;
+   unsigned i;
+
+   for (i = 0; i < sizeof(pname_descriptors) / sizeof(pname_descriptors[0]);
+        i++) {
+      if (pname_descriptors[i].pname == pname)
+         return &pname_descriptors[i];
    }
+
+   return NULL;
+}
+
+/* Value stored on the value_count_cache for the sample counts not
+ * queried yet */
+#define SAMPLE_COUNTS_UNKNOWN INT64_MIN
+
+struct _value_count_cache {
+   unsigned num_targets;
+   unsigned num_internalformats;
+   GLint64 num_sample_counts[];
+};
+
+value_count_cache*
+value_count_cache_new(unsigned num_targets,
+                      unsigned num_internalformats)
+{
+   value_count_cache *result;
+   unsigned num_cells = num_targets * num_internalformats;
+   unsigned i;
+
+   result = (value_count_cache*) malloc(sizeof(value_count_cache) +
+                                        num_cells * sizeof(GLint64));
+   result->num_targets = num_targets;
+   result->num_internalformats = num_internalformats;
+   for (i = 0; i < num_cells; i++)
+      result->num_sample_counts[i] = SAMPLE_COUNTS_UNKNOWN;
+
+   return result;
+}
+
+/*
+ * Frees @cache, and sets its value to NULL.
+ */
+void
+value_count_cache_clear(value_count_cache **cache)
+{
+   free(*cache);
+   *cache = NULL;
+}
+
+/*
+ * Returns the number of values that the pname of @descriptor returns
+ * for @target and @internalformat, being @target_index and
+ * @internalformat_index their position on the cache. For example, for
+ * the case of GL_SAMPLES, it returns as many sample counts as the
+ * value returned by GL_NUM_SAMPLE_COUNTS. That is the only case that
+ * can do GL calls, and only the first time for each
+ * target/internalformat.
+ */
+int
+value_count_cache_get(value_count_cache *cache,
+                      const pname_descriptor *descriptor,
+                      unsigned target_index,
+                      unsigned internalformat_index,
+                      GLenum target,
+                      GLenum internalformat)
+{
+   GLint64 *count;
+
+   if (descriptor->count != PNAME_VALUE_COUNT_SAMPLE_COUNTS)
+      return 1;
+
+   count = &cache->num_sample_counts[target_index * cache->num_internalformats +
+                                     internalformat_index];
+   if (*count == SAMPLE_COUNTS_UNKNOWN)
+      *count = get_num_sample_counts(target, internalformat);
+
+   return *count;
+}
+
+/* Number of values of a result, from the count given by the
+ * value_count_cache. If there are no values, we still print the first
+ * one, that has the reference value set before the query. */
+static inline int
+clamp_num_values(int num_values)
+{
+   if (num_values < 1)
+      return 1;
+   if (num_values > QUERY_RESULT_MAX_VALUES)
+      return QUERY_RESULT_MAX_VALUES;
+   return num_values;
+}
+
+/*
+ * Runs the 32-bit query for @pname, @target and @internalformat, and
+ * fills @result with its outcome, being @num_values the count given by
+ * the value_count_cache. It is the same as test_data_execute, but
+ * without any indirection nor width check per call, for the sweep.
+ * @params is the storage for the query, that must be kept between
+ * calls, as the values not written by the query are the ones of the
+ * previous one.
+ */
+void
+query_result_execute32(GLint params[QUERY_RESULT_MAX_VALUES],
+                       const pname_descriptor *descriptor,
+                       GLenum target,
+                       GLenum internalformat,
+                       int num_values,
+                       query_result *result)
+{
+   const GLenum pname = descriptor->pname;
+   int count = clamp_num_values(num_values);
+   int i;
+
+   /* Some queries will not modify params if unsupported. Use -1 as
+    * reference value. */
+   params[0] = -1;
+   trace_gl.get_internalformativ(target, internalformat, pname,
+                                 QUERY_RESULT_MAX_VALUES, params);
+
+   result->descriptor = descriptor;
+   result->pname = pname;
+   result->target = target;
+   result->internalformat = internalformat;
+   result->testing64 = 0;
+   result->num_values = count;
+   for (i = 0; i < count; i++)
+      result->values[i] = params[i];
+}
+
+/*
+ * The 64-bit version of query_result_execute32.
+ */
+void
+query_result_execute64(GLint64 params[QUERY_RESULT_MAX_VALUES],
+                       const pname_descriptor *descriptor,
+                       GLenum target,
+                       GLenum internalformat,
+                       int num_values,
+                       query_result *result)
+{
+   const GLenum pname = descriptor->pname;
+   int count = clamp_num_values(num_values);
+
+   params[0] = -1;
+   trace_gl.get_internalformati64v(target, internalformat, pname,
+                                   QUERY_RESULT_MAX_VALUES, params);
+
+   result->descriptor = descriptor;
+   result->pname = pname;
+   result->target = target;
+   result->internalformat = internalformat;
+   result->testing64 = 1;
+   result->num_values = count;
+   memcpy(result->values, params, count * sizeof(GLint64));
 }
 
 /*
- * Prints the info of a case for a given pname, in a csv format. In order to
- * get that the value is included on "", as some queries returns more than one
- * value (ex: GL_SAMPLES).
- * @target, @internalformat, @pname are the parameters othe the given query.
- * @data contains the outcome of the query already being executed, so the given value.
+ * Prints @result in a csv format. In order to get that the value is
+ * included on "", as some queries returns more than one value (ex:
+ * GL_SAMPLES).
+ * @out is the buffer where the case is printed.
  *
+ * Note that this doesn't do any GL call, so it can be used from any
+ * thread, or with results that were not queried on this run.
  */
 void
-print_case(const GLenum target,
-           const GLenum internalformat,
-           const GLenum pname,
-           const test_data *data)
+print_result(output_buffer *out,
+             const query_result *result)
 {
-   fprintf(stdout, "%s, %s, %s, %s, ",
-           data->testing64 ? "64 bit" : "32 bit",
-           util_get_gl_enum_name(pname),
-           util_get_gl_enum_name(target),
-           util_get_gl_enum_name(internalformat));
-
-   if (pname_returns_enum(pname)) {
-      fprintf(stdout, "\"%s\"\n",
-              get_value_enum_name(pname, test_data_value_at_index(data, 0)));
-   } else {
-      int count = pname_value_count(pname, target, internalformat);
-      int i = 0;
+   output_buffer_append(out, result->testing64 ? "64 bit, " : "32 bit, ", 8);
+   append_enum_name(out, result->pname);
+   output_buffer_append(out, ", ", 2);
+   append_enum_name(out, result->target);
+   output_buffer_append(out, ", ", 2);
+   append_enum_name(out, result->internalformat);
+   output_buffer_append(out, ", \"", 3);
+
+   /* Results of pnames without descriptor are printed as enums */
+   if (result->descriptor != NULL)
+      result->descriptor->format(out, result);
+   else
+      append_enum_name(out, result->values[0]);
 
-      fprintf(stdout, "\"");
-      for (i = 0; i < count - 1; i++) {
-         fprintf(stdout, "%" PRIi64 ",", test_data_value_at_index(data, i));
-      }
-      fprintf(stdout, "%" PRIi64 "\"\n", test_data_value_at_index(data, i));
-   }
+   output_buffer_append(out, "\"\n", 2);
 }
 
 
+/*
+ * Returns the current value of the monotonic clock, in nanoseconds.
+ */
+uint64_t
+get_time_ns(void)
+{
+   struct timespec ts;
+
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+
+   return (uint64_t) ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
 /*
  * Checks for OpenGL error if one ocurred, and prints it. Retuns true if any
  * error found;
@@ -389,13 +566,13 @@ check_ogl_error (char *file,
    GLenum gl_err;
    bool result = false;
 
-   gl_err = glGetError();
+   gl_err = trace_gl.get_error();
    while (gl_err != GL_NO_ERROR) {
       result = true;
       fprintf(stderr,"gl_error in file %s @ line %d: %s\n",
               file, line, gluErrorString(gl_err));
 
-      gl_err = glGetError();
+      gl_err = trace_gl.get_error();
    }
 
    return result;
@@ -20,8 +20,15 @@
  * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
  * IN THE SOFTWARE.
  */
+#ifndef UTIL_H
+#define UTIL_H
+
 #include <GL/glew.h>
 #include <stdbool.h>
+#include <stdint.h>
+
+#include "output.h"
+#include "pname-table.h"
 
 static const GLenum valid_targets[] = {
    GL_TEXTURE_1D,
@@ -38,82 +45,11 @@ static const GLenum valid_targets[] = {
    GL_TEXTURE_2D_MULTISAMPLE_ARRAY,
 };
 
+#define PNAME_TABLE_ENTRY(pname, kind, count) pname,
 static const GLenum valid_pnames[] = {
-   GL_SAMPLES,
-   GL_NUM_SAMPLE_COUNTS,
-   GL_INTERNALFORMAT_SUPPORTED,
-   GL_INTERNALFORMAT_PREFERRED,
-   GL_INTERNALFORMAT_RED_SIZE,
-   GL_INTERNALFORMAT_GREEN_SIZE,
-   GL_INTERNALFORMAT_BLUE_SIZE,
-   GL_INTERNALFORMAT_ALPHA_SIZE,
-   GL_INTERNALFORMAT_DEPTH_SIZE,
-   GL_INTERNALFORMAT_STENCIL_SIZE,
-   GL_INTERNALFORMAT_SHARED_SIZE,
-   GL_INTERNALFORMAT_RED_TYPE,
-   GL_INTERNALFORMAT_GREEN_TYPE,
-   GL_INTERNALFORMAT_BLUE_TYPE,
-   GL_INTERNALFORMAT_ALPHA_TYPE,
-   GL_INTERNALFORMAT_DEPTH_TYPE,
-   GL_INTERNALFORMAT_STENCIL_TYPE,
-   GL_MAX_WIDTH,
-   GL_MAX_HEIGHT,
-   GL_MAX_DEPTH,
-   GL_MAX_LAYERS,
-   GL_MAX_COMBINED_DIMENSIONS,
-   GL_COLOR_COMPONENTS,
-   GL_DEPTH_COMPONENTS,
-   GL_STENCIL_COMPONENTS,
-   GL_COLOR_RENDERABLE,
-   GL_DEPTH_RENDERABLE,
-   GL_STENCIL_RENDERABLE,
-   GL_FRAMEBUFFER_RENDERABLE,
-   GL_FRAMEBUFFER_RENDERABLE_LAYERED,
-   GL_FRAMEBUFFER_BLEND,
-   GL_READ_PIXELS,
-   GL_READ_PIXELS_FORMAT,
-   GL_READ_PIXELS_TYPE,
-   GL_TEXTURE_IMAGE_FORMAT,
-   GL_TEXTURE_IMAGE_TYPE,
-   GL_GET_TEXTURE_IMAGE_FORMAT,
-   GL_GET_TEXTURE_IMAGE_TYPE,
-   GL_MIPMAP,
-   GL_MANUAL_GENERATE_MIPMAP,
-   GL_AUTO_GENERATE_MIPMAP,
-   GL_COLOR_ENCODING,
-   GL_SRGB_READ,
-   GL_SRGB_WRITE,
-   GL_SRGB_DECODE_ARB,
-   GL_FILTER,
-   GL_VERTEX_TEXTURE,
-   GL_TESS_CONTROL_TEXTURE,
-   GL_TESS_EVALUATION_TEXTURE,
-   GL_GEOMETRY_TEXTURE,
-   GL_FRAGMENT_TEXTURE,
-   GL_COMPUTE_TEXTURE,
-   GL_TEXTURE_SHADOW,
-   GL_TEXTURE_GATHER,
-   GL_TEXTURE_GATHER_SHADOW,
-   GL_SHADER_IMAGE_LOAD,
-   GL_SHADER_IMAGE_STORE,
-   GL_SHADER_IMAGE_ATOMIC,
-   GL_IMAGE_TEXEL_SIZE,
-   GL_IMAGE_COMPATIBILITY_CLASS,
-   GL_IMAGE_PIXEL_FORMAT,
-   GL_IMAGE_PIXEL_TYPE,
-   GL_IMAGE_FORMAT_COMPATIBILITY_TYPE,
-   GL_SIMULTANEOUS_TEXTURE_AND_DEPTH_TEST,
-   GL_SIMULTANEOUS_TEXTURE_AND_STENCIL_TEST,
-   GL_SIMULTANEOUS_TEXTURE_AND_DEPTH_WRITE,
-   GL_SIMULTANEOUS_TEXTURE_AND_STENCIL_WRITE,
-   GL_TEXTURE_COMPRESSED,
-   GL_TEXTURE_COMPRESSED_BLOCK_WIDTH,
-   GL_TEXTURE_COMPRESSED_BLOCK_HEIGHT,
-   GL_TEXTURE_COMPRESSED_BLOCK_SIZE,
-   GL_CLEAR_BUFFER,
-   GL_TEXTURE_VIEW,
-   GL_VIEW_COMPATIBILITY_CLASS
+   PNAME_TABLE(PNAME_TABLE_ENTRY)
 };
+#undef PNAME_TABLE_ENTRY
 
 /* From spec:
  *
@@ -226,6 +162,8 @@ static const GLenum valid_internalformats[] = {
    GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT,
 };
 
+uint64_t get_time_ns(void);
+
 #define check_gl_error() check_ogl_error(__FILE__, __LINE__)
 bool check_ogl_error(char *file,
                      int line);
@@ -256,8 +194,99 @@ bool test_data_check_supported(const test_data *data,
                                const GLenum target,
                                const GLenum internalformat);
 
-void print_case(const GLenum target,
-                const GLenum internalformat,
-                const GLenum pname,
-                const test_data *data);
+typedef struct _support_matrix support_matrix;
+
+support_matrix* support_matrix_new(const GLenum *targets,
+                                   unsigned num_targets,
+                                   const GLenum *internalformats,
+                                   unsigned num_internalformats);
+
+void support_matrix_clear(support_matrix **matrix);
+
+bool support_matrix_is_supported(const support_matrix *matrix,
+                                 unsigned target_index,
+                                 unsigned internalformat_index);
+
+enum pname_value_kind {
+   PNAME_VALUE_INTEGER,
+   PNAME_VALUE_BOOLEAN,
+   PNAME_VALUE_ENUM,
+};
+
+enum pname_value_count {
+   PNAME_VALUE_COUNT_ONE,
+   PNAME_VALUE_COUNT_SAMPLE_COUNTS,
+};
+
+typedef struct _query_result query_result;
+
+/* Appends to @out the values of @result, as printed by print_result */
+typedef void (*pname_formatter)(output_buffer *out,
+                                const query_result *result);
+
+/* What is known about a pname, from pname-table.h */
+typedef struct _pname_descriptor {
+   GLenum pname;
+   enum pname_value_kind kind;
+   enum pname_value_count count;
+   pname_formatter format;
+} pname_descriptor;
+
+const pname_descriptor* pname_descriptor_get(GLenum pname);
+
+/* Number of values returned by each pname/target/internalformat,
+ * indexed by the position of the target/internalformat on the arrays
+ * used to build it. It is 1 for all the pnames but the ones with the
+ * PNAME_VALUE_COUNT_SAMPLE_COUNTS count (GL_SAMPLES), that return as
+ * many values as GL_NUM_SAMPLE_COUNTS, queried the first time that it
+ * is needed for each target/internalformat. */
+typedef struct _value_count_cache value_count_cache;
+
+value_count_cache* value_count_cache_new(unsigned num_targets,
+                                         unsigned num_internalformats);
+
+void value_count_cache_clear(value_count_cache **cache);
+
+int value_count_cache_get(value_count_cache *cache,
+                          const pname_descriptor *descriptor,
+                          unsigned target_index,
+                          unsigned internalformat_index,
+                          GLenum target,
+                          GLenum internalformat);
+
+/* Maximum number of values returned by a query. Big enough for the
+ * sample counts returned by GL_SAMPLES */
+#define QUERY_RESULT_MAX_VALUES 64
+
+/* Outcome of one query, with all the values that would be printed
+ * for it. */
+struct _query_result {
+   /* Descriptor of the pname, so it doesn't need to be looked up to
+    * print the result */
+   const pname_descriptor *descriptor;
+   GLenum pname;
+   GLenum target;
+   GLenum internalformat;
+   int testing64;
+   int num_values;
+   GLint64 values[QUERY_RESULT_MAX_VALUES];
+};
+
+void query_result_execute32(GLint params[QUERY_RESULT_MAX_VALUES],
+                            const pname_descriptor *descriptor,
+                            GLenum target,
+                            GLenum internalformat,
+                            int num_values,
+                            query_result *result);
+
+void query_result_execute64(GLint64 params[QUERY_RESULT_MAX_VALUES],
+                            const pname_descriptor *descriptor,
+                            GLenum target,
+                            GLenum internalformat,
+                            int num_values,
+                            query_result *result);
+
+void print_result(output_buffer *out,
+                  const query_result *result);
 
+#endif /* UTIL_H */